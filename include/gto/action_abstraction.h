@@ -1,6 +1,8 @@
 #ifndef GTO_ACTION_ABSTRACTION_H
 #define GTO_ACTION_ABSTRACTION_H
 
+#include <array>
+#include <span>
 #include <vector>
 #include <string>
 #include <set> // Pour stocker les fractions de pot uniques
@@ -17,6 +19,7 @@ namespace gto_solver {
 // Déclarations anticipées pour casser le cycle d'inclusion
 class GameState;
 enum class Street; // Ok pour enum class
+class IniFile;
 
 // Forward declaration plus nécessaire car on inclut game_state.h
 // class GameState; 
@@ -51,6 +54,33 @@ struct Action {
 // Pré-déclaration si GameState est utilisé seulement par référence/pointeur
 // class GameState; <-- Redondant car déjà déclaré plus haut
 
+// Tailles de relance proposées à un niveau de relance donné.
+struct RaiseSizing {
+    std::set<double> pot_fractions;
+    std::set<double> bb_sizes;
+    std::set<int> exact_bets;
+};
+
+// Abstraction d'une street. raise_levels[k] s'applique quand k relances ont déjà eu lieu
+// dans la street (GameState::get_street_raise_count, les blinds ne comptent pas) ; au-delà
+// du dernier niveau, le dernier s'applique. Un niveau sans taille ne propose que l'all-in.
+struct StreetAbstraction {
+    std::vector<RaiseSizing> raise_levels;
+    int max_raises = -1; // Relances autorisées dans la street, all-in compris (-1 : illimité)
+};
+
+// Configuration complète d'une ActionAbstraction (streets absentes : all-in seul).
+struct ActionAbstractionConfig {
+    bool allow_fold = true;
+    bool allow_check_call = true;
+    bool allow_all_in = true;
+    std::map<Street, StreetAbstraction> streets;
+
+    // Lecture déclarative (voir ActionAbstraction::from_ini pour le format).
+    // Lève std::invalid_argument pour une clé inconnue ou une valeur invalide.
+    static ActionAbstractionConfig from_ini(const IniFile& ini);
+};
+
 // Classe pour définir et appliquer une abstraction d'actions
 class ActionAbstraction {
 public:
@@ -69,9 +99,29 @@ public:
         const StreetExactBetsMap& exact_bets_by_street = {}, // Nouveau paramètre
         bool allow_all_in = true
     );
+    explicit ActionAbstraction(const ActionAbstractionConfig& config);
+
+    // Abstraction décrite par un fichier INI :
+    //   [abstraction]      allow_fold, allow_check_call, allow_all_in (booléens)
+    //   [flop]             pot_fractions, bb_sizes, exact_bets (listes), max_raises
+    //   [flop.raise2]      tailles après 2 relances dans la street (pot_fractions, bb_sizes, exact_bets)
+    // Sections de street : preflop, flop, turn, river. Un niveau non décrit reprend le
+    // précédent ; une liste vide (« pot_fractions = ») le limite à l'all-in. Les autres
+    // sections sont ignorées (fichier partagé avec la configuration du solveur).
+    static ActionAbstraction from_ini(const IniFile& ini);
+    static ActionAbstraction load(const std::string& filename);
 
     // Méthode principale pour obtenir les actions abstraites légales pour un état donné
+    // (fold, check/call, puis relances par montant croissant, sans doublon).
     std::vector<Action> get_abstract_actions(const GameState& state) const;
+    // Idem dans un vecteur fourni (vidé puis rempli) : sa capacité est réutilisée d'un appel à l'autre.
+    void get_abstract_actions(const GameState& state, std::vector<Action>& actions) const;
+    // Idem sans allocation : écrit dans out (au moins max_actions() places, sinon
+    // std::invalid_argument) et retourne le nombre d'actions.
+    size_t get_abstract_actions(const GameState& state, std::span<Action> out) const;
+
+    // Nombre maximal d'actions légales en un nœud (capacité des tampons de get_abstract_actions).
+    size_t max_actions() const { return max_actions_; }
 
     // Méthodes publiques (signatures basées sur le .cpp) <-- SUPPRIMÉ
     /*
@@ -80,18 +130,26 @@ public:
     */
 
 private:
+    // Streets où l'on mise (PREFLOP à RIVER), index des tables de tailles.
+    static constexpr size_t NUM_BETTING_STREETS = 4;
+
+    // Tailles d'un niveau de relance, compilées à la construction : tableaux plats triés,
+    // valeurs <= 0 écartées.
+    struct StreetSizing {
+        std::vector<double> pot_fractions;
+        std::vector<double> bb_multipliers;
+        std::vector<int> exact_bets;
+    };
+    struct StreetRules {
+        std::vector<StreetSizing> levels; // Vide : all-in seul
+        int max_raises = -1;
+    };
+
     bool allow_fold_;
     bool allow_check_call_;
-    // Modification: Map Street -> set<double>
-    StreetFractionsMap fractions_by_street_; 
-    StreetBBSizesMap bb_sizes_by_street_;
-    StreetExactBetsMap exact_bets_by_street_; // Nouveau membre
+    std::array<StreetRules, NUM_BETTING_STREETS> rules_by_street_;
     bool allow_all_in_;
-
-    // Méthodes helper (privées)
-    void add_fold_action(std::vector<Action>& actions, const GameState& state) const;
-    void add_check_call_action(std::vector<Action>& actions, const GameState& state) const;
-    void add_raise_actions(std::vector<Action>& actions, const GameState& state) const;
+    size_t max_actions_ = 0;
 };
 
 } // namespace gto_solver
@@ -0,0 +1,85 @@
+#ifndef GTO_ACTION_TRANSLATION_H
+#define GTO_ACTION_TRANSLATION_H
+
+#include "gto/action_abstraction.h"
+#include "core/rng.hpp"
+#include <vector>
+
+namespace gto_solver {
+
+class GameState;
+
+// Taille d'une relance en fraction du pot : (total_bet - mise max) / (pot + montant à payer),
+// même base que les fractions de ActionAbstraction.
+double raise_pot_fraction(const GameState& state, int total_bet);
+
+// Mapping pseudo-harmonique (Ganzfried & Sandholm) : probabilité de traduire une relance
+// de taille x vers la taille abstraite a, plutôt que b (a <= x <= b, fractions de pot).
+// f(x) = (b - x)(1 + a) / ((b - a)(1 + x)).
+double pseudo_harmonic_probability(double a, double b, double x);
+
+enum class TranslationMode {
+    DETERMINISTIC, // Voisin le plus probable selon le mapping pseudo-harmonique
+    RANDOMIZED     // Tirage entre les deux voisins selon le mapping pseudo-harmonique
+};
+
+// Résultat d'une traduction : index dans les actions abstraites légales. lower == upper
+// quand l'action est dans l'arbre ou hors des bornes (taille la plus proche).
+struct TranslatedAction {
+    int lower = -1;
+    int upper = -1;
+    double lower_probability = 1.0;
+
+    bool valid() const { return lower >= 0; }
+    // Probabilité de traduction vers l'action abstraite d'index i.
+    double probability(int i) const {
+        return (i == lower ? lower_probability : 0.0) + (i == upper ? 1.0 - lower_probability : 0.0);
+    }
+};
+
+// Table de traduction d'un nœud de décision : fractions de pot des relances abstraites,
+// triées, pour une recherche dichotomique sans allocation. À construire une fois par nœud
+// (les actions légales et le pot ne changent pas) et à réutiliser pour chaque requête.
+class TranslationTable {
+public:
+    TranslationTable(const GameState& state, const std::vector<Action>& legal_actions);
+
+    TranslatedAction translate(const Action& action) const;
+    TranslatedAction translate_raise_fraction(double fraction) const;
+
+private:
+    std::vector<double> raise_fractions_; // Croissantes
+    std::vector<int> raise_indices_;      // Index correspondants dans les actions légales
+    int fold_index_ = -1;
+    int call_index_ = -1;
+    int max_bet_ = 0;
+    int pot_if_call_ = 1;
+};
+
+// Traduction d'actions réelles (tailles quelconques) vers l'abstraction : les relances
+// hors arbre sont ramenées aux deux relances abstraites voisines, fold et call à eux-mêmes.
+class ActionTranslator {
+public:
+    explicit ActionTranslator(const ActionAbstraction& action_abstraction,
+                              TranslationMode mode = TranslationMode::RANDOMIZED);
+
+    // Voisins abstraits de action dans state et leurs probabilités.
+    TranslatedAction translate(const GameState& state, const Action& action) const;
+
+    // Action abstraite retenue (tirage avec rng en mode RANDOMIZED). Lève
+    // std::invalid_argument si aucune action abstraite n'a le type de action.
+    Action map(const GameState& state, const Action& action, Rng& rng) const;
+
+    // Choix final selon le mode, sur une traduction déjà calculée (chemin rapide avec TranslationTable).
+    int resolve(const TranslatedAction& translated, Rng& rng) const;
+
+    TranslationMode get_mode() const { return mode_; }
+
+private:
+    const ActionAbstraction& action_abstraction_;
+    TranslationMode mode_;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_ACTION_TRANSLATION_H
@@ -0,0 +1,97 @@
+#ifndef GTO_BEST_RESPONSE_H
+#define GTO_BEST_RESPONSE_H
+
+#include "gto/cfr_engine.h"
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include "gto/hand_range.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace gto_solver {
+
+struct ExploitabilityResult {
+    // Valeur (jetons par main, du point de vue du joueur) de la meilleure réponse
+    // de chaque joueur contre la stratégie moyenne de l'autre.
+    std::array<double, 2> best_response_values{};
+    // (BR0 + BR1) / 2 : nul à l'équilibre de Nash, toujours >= 0 sur le jeu exact.
+    double exploitability_chips = 0.0;
+    double exploitability_mbb = 0.0; // Milli-big-blinds par main
+    int chance_samples = 0;          // Issues tirées par nœud de hasard (voir compute)
+    double elapsed_seconds = 0.0;
+    // Faux si la partie ou le moteur ne sont pas couverts (voir BestResponse::is_supported) :
+    // aucune valeur n'est alors calculée et les champs ci-dessus restent nuls.
+    bool supported = true;
+};
+
+// Calcul de meilleure réponse sur l'arbre public de l'abstraction.
+// L'arbre des actions est parcouru une fois par joueur avec des vecteurs de 1326 mains
+// (range adverse pondérée par la stratégie moyenne, valeurs de la meilleure réponse par
+// main). Les cartes de board non encore sorties sont des nœuds de hasard de la traversée :
+// les valeurs sont moyennées sur les cartes à venir avant le max du joueur BR, qui ne
+// connaît donc pas le futur. Les issues de chaque nœud de hasard sont énumérées, ou
+// échantillonnées (estimation sans biais des valeurs) quand elles sont trop nombreuses.
+// Peut être appelé entre deux appels à CFREngine::run_iterations pour suivre la convergence.
+// Limité au heads-up (2 joueurs) sans transpositions (voir is_supported).
+class BestResponse {
+public:
+    BestResponse(const CFREngine& engine, const ActionAbstraction& action_abstraction);
+
+    // Heads-up uniquement, et clés d'infoset par historique d'actions : avec des
+    // transpositions (TranspositionRule), les clés du moteur ne sont pas retrouvées.
+    bool is_supported(const GameState& root_state) const;
+
+    // root_state: début de la main (les cartes déjà au board sont conservées,
+    // les cartes privées de root_state sont ignorées : les deux ranges sont uniformes).
+    // num_chance_samples: issues par nœud de hasard ; toutes sont énumérées quand il y en
+    // a au plus num_chance_samples (calcul exact), sinon num_chance_samples sont tirées,
+    // les mêmes pour toutes les lignes d'actions menant au même board.
+    // num_threads <= 0 : std::thread::hardware_concurrency() ; les issues des premiers
+    // nœuds de hasard rencontrés sont réparties entre les threads.
+    // Le résultat ne dépend que de seed, pas du nombre de threads.
+    // Hors is_supported : résultat avec supported = false.
+    ExploitabilityResult compute(const GameState& root_state,
+                                 int num_chance_samples,
+                                 int num_threads = 0,
+                                 uint64_t seed = 0) const;
+
+private:
+    // Paramètres d'une traversée, et board complet courant.
+    struct TraversalContext {
+        int br_player = 0;
+        int chance_samples = 0;
+        uint64_t seed = 0;
+        int threads = 1;                       // Threads disponibles au prochain nœud de hasard
+        const BoardRanking* ranking = nullptr; // Board complet (showdowns), sinon nul
+    };
+
+    // Retourne, pour chaque main du joueur br_player, la valeur contrefactuelle
+    // (pondérée par opp_reach, espérance sur les cartes de board à venir) de la
+    // meilleure réponse depuis state.
+    RangeVector traverse(const GameState& state,
+                         std::vector<Action>& action_history,
+                         const RangeVector& opp_reach,
+                         const TraversalContext& ctx) const;
+
+    // Nœud de hasard : moyenne des valeurs des issues, mains bloquées par l'issue exclues.
+    RangeVector chance_values(const GameState& state,
+                              std::vector<Action>& action_history,
+                              const RangeVector& opp_reach,
+                              const TraversalContext& ctx) const;
+
+    RangeVector terminal_values(const GameState& state,
+                                const RangeVector& opp_reach,
+                                const TraversalContext& ctx) const;
+
+    // Stratégie moyenne de l'infoset (uniforme s'il est absent ou incompatible).
+    void average_strategy(const std::string& infoset_key, size_t num_actions, std::vector<double>& out) const;
+
+    const CFREngine& engine_;
+    const ActionAbstraction& action_abstraction_;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_BEST_RESPONSE_H
@@ -4,16 +4,120 @@
 #include "gto/game_state.h"
 #include "gto/action_abstraction.h"
 #include "gto/information_set.h"
+#include "gto/cfr_metrics.h"
+#include "gto/chance.h"
+#include "gto/hand_range.h"
+#include "gto/payoffs.h"
+#include "gto/legal_action_cache.h"
 #include "eval/hand_evaluator.hpp" // Pour évaluer les mains au showdown
+#include "core/scratch_arena.hpp"
+#include <array>
 #include <vector>
 #include <string>
 #include <map>
+#include <chrono>
+#include <memory>
+#include <span>
 
 namespace gto_solver {
 
+// Traitement du hasard (distribution des cartes) à chaque itération.
+enum class ChanceSampling {
+    FIXED_DEAL,  // Toutes les itérations jouent la donne de l'état initial fourni
+    SAMPLE_DEAL  // Nouvelle donne tirée à chaque itération (chance sampling)
+};
+
+// Cartes de board dans l'arbre de traversée.
+enum class BoardChance {
+    DEALT,     // Tirées du deck de GameState au changement de street (fixées pour l'itération)
+    SAMPLE,    // Nœuds de hasard explicites : une carte tirée par le générateur du moteur
+    ENUMERATE  // Nœuds de hasard explicites : toutes les turns et rivers, pondérées (flop tiré)
+};
+
+// Variante de traversée de l'arbre à chaque itération.
+enum class TraversalMode {
+    VANILLA,               // Une main privée par joueur (voir chance_sampling, board_chance)
+    PUBLIC_CHANCE_SAMPLING // PCS, heads-up : un board complet tiré par itération, toutes les
+                           // mains privées mises à jour ensemble (vecteurs de 1326 combos)
+};
+
+// Identification des nœuds de l'arbre de mises dans les clés d'infoset.
+enum class TranspositionRule {
+    NONE,        // Historique complet des actions : chaque séquence est un nœud distinct
+    PUBLIC_STATE // Séquences menant au même état public (GameState::public_state_hash) fusionnées.
+                 // Le joueur "oublie" par quelle séquence il est arrivé (pas de mémoire parfaite) ;
+                 // les clés ne sont plus lisibles par BestResponse, SubgameSolver ni RealtimeResolver.
+};
+
+// Options du moteur, fixées à la construction.
+struct CFREngineConfig {
+    TraversalMode traversal_mode = TraversalMode::VANILLA;
+    // VANILLA uniquement (PCS ignore les mains de l'état et tire tout le board).
+    ChanceSampling chance_sampling = ChanceSampling::SAMPLE_DEAL;
+    // Graine du générateur du moteur : deux moteurs de même configuration
+    // produisent exactement le même entraînement.
+    uint64_t seed = DEFAULT_RNG_SEED;
+
+    BoardChance board_chance = BoardChance::DEALT;
+    // ENUMERATE : une seule carte par classe de couleurs équivalentes (voir
+    // enumerate_chance_outcomes), pondérée par la taille de la classe. La couleur
+    // représentante est tirée à chaque nœud avec le générateur de la traversée : les clés
+    // d'infoset n'étant pas canoniques par couleur, chaque carte de la classe est ainsi
+    // visitée avec sa probabilité réelle en espérance (au prix d'un peu de variance).
+    bool suit_isomorphic_chance = true;
+    // ENUMERATE : threads entre lesquels sont répartis les sous-arbres de chaque carte de
+    // river. Seule la river est parallélisée : les clés d'infoset trient le board, donc les
+    // sous-arbres turn X / river Y et turn Y / river X partagent leurs infosets, alors que
+    // deux rivers distinctes n'en ont aucun en commun. 0 : hardware_concurrency.
+    int chance_threads = 1;
+    // Nœud terminal à board incomplet (all-in en mode DEALT : le board n'y est pas déroulé
+    // par des nœuds de hasard) : au-delà de ce nombre de runouts restants, autant de runouts
+    // tirés avec le générateur de la traversée au lieu de l'énumération exacte (voir
+    // terminal_utilities). 0 : énumération exacte.
+    int terminal_runout_samples = 16;
+
+    // Précision des regrets / stratégies cumulés de chaque infoset.
+    StoragePrecision storage_precision;
+
+    // Élagage par regret (regret-based pruning) : une action sans probabilité dans la
+    // stratégie courante et dont le regret cumulé est < pruning_threshold n'est pas
+    // explorée (sauf si elle mène directement à un nœud terminal).
+    // Pas d'élagage pendant les pruning_warmup_iterations premières itérations, ni
+    // pendant une itération sur pruning_full_traversal_interval (exploration complète,
+    // qui permet aux actions élaguées de regagner du regret).
+    // Compromis : le sous-arbre élagué n'est pas visité du tout, donc les stratégies
+    // cumulées des adversaires qui y jouent ne sont mises à jour que pendant le warm-up et
+    // les itérations d'exploration complète. Leur stratégie moyenne est biaisée vers ces
+    // itérations ; le biais reste faible car la ligne n'est (presque) plus jouée par le
+    // joueur élagué, mais un intervalle d'exploration plus court le réduit.
+    bool enable_regret_pruning = false;
+    double pruning_threshold = -300.0; // En jetons
+    int pruning_warmup_iterations = 100;
+    int pruning_full_traversal_interval = 20;
+
+    // Élagage par probabilité d'atteinte : un sous-arbre où, pour chaque joueur, la
+    // probabilité d'atteinte des adversaires (hasard compris) est <= reach_pruning_epsilon
+    // n'est pas visité (utilités nulles). Aucun regret n'y changerait (à epsilon près) ;
+    // en heads-up les stratégies cumulées non plus, à 3 joueurs et plus celles d'un joueur
+    // dont seuls les adversaires ne peuvent atteindre le sous-arbre ne sont pas cumulées.
+    bool enable_reach_pruning = false;
+    double reach_pruning_epsilon = 0.0;
+
+    // Transpositions de l'arbre de mises (opt-in, voir TranspositionRule).
+    TranspositionRule transpositions = TranspositionRule::NONE;
+
+    // Actions légales mémoïsées par état de mise public (LegalActionCache) : les nœuds
+    // d'une même ligne de mises ne recalculent pas les tailles à chaque donne.
+    bool cache_legal_actions = false;
+
+    // Mesure du temps exclusif par street (CFRMetrics::street_seconds).
+    // Deux lectures d'horloge par nœud : désactivé par défaut.
+    bool enable_street_timing = false;
+};
+
 class CFREngine {
 public:
-    CFREngine(const ActionAbstraction& action_abstraction);
+    CFREngine(const ActionAbstraction& action_abstraction, const CFREngineConfig& config = {});
 
     // Lance N itérations de l'algorithme CFR.
     void run_iterations(int num_iterations, GameState initial_state);
@@ -23,24 +127,121 @@ public:
 
     // Permet d'accéder à la map des infosets (pour analyse ou debug)
     const InformationSetMap& get_infoset_map() const { return infoset_map_; }
+    const CFREngineConfig& get_config() const { return config_; }
+    // Nombre total d'itérations effectuées (cumulé sur les appels à run_iterations).
+    int get_iteration_count() const { return iteration_count_; }
+    // Nombre de branches non explorées grâce à l'élagage par regret.
+    long long get_pruned_branch_count() const { return metrics_.pruned_branches; }
+
+    // Compteurs de performance et instantané de la table d'infosets.
+    CFRMetrics get_metrics() const;
+    void reset_metrics();
 
     // Méthodes pour sauvegarder et charger la map des infosets
     bool save_infoset_map(const std::string& filename) const;
     bool load_infoset_map(const std::string& filename);
 
+    // --- Checkpoints incrémentaux ---
+    // Ajoute (mode append) au fichier delta uniquement les infosets modifiés depuis
+    // le dernier checkpoint, puis remet leur drapeau `dirty` à false.
+    bool save_infoset_delta(const std::string& filename);
+    // Applique un fichier delta par-dessus la map courante (sans la vider).
+    bool apply_infoset_delta(const std::string& filename);
+    // À appeler après un save_infoset_map() pour démarrer une nouvelle chaîne de deltas.
+    void clear_dirty_flags();
+    size_t count_dirty_infosets() const;
+
+    // Fusionne un checkpoint de base et ses deltas (dans l'ordre d'écriture) en un
+    // nouveau checkpoint complet. Les entrées les plus récentes l'emportent.
+    static bool compact_checkpoints(const std::string& base_filename,
+                                    const std::vector<std::string>& delta_filenames,
+                                    const std::string& output_filename);
+
 private:
+    // État propre à un thread de traversée.
+    struct TraversalContext {
+        // Historique des actions de la main courante (clé d'infoset).
+        std::vector<Action> action_history;
+        CFRMetrics metrics;
+        Rng rng;
+        // Non nul dans une région parallèle : les infosets absents de infoset_map_ y sont
+        // créés, puis fusionnés après la région (infoset_map_ n'est alors qu'en lecture).
+        InformationSetMap* overlay = nullptr;
+        // Tampons par nœud (actions légales, stratégie, valeurs d'action...) : arène du thread,
+        // un Frame par nœud.
+        ScratchArena* scratch = nullptr;
+        Street timed_street = Street::PREFLOP;
+        std::chrono::steady_clock::time_point timed_since;
+    };
+
+    // Tableaux de taille fixe de la traversée (aucune allocation par nœud). NumPlayers : 2
+    // pour le chemin heads-up (tailles et boucles sur les joueurs fixées à la compilation,
+    // terminaux à somme nulle), 0 pour un nombre de joueurs quelconque (jusqu'à MAX_PLAYERS).
+    template <int NumPlayers>
+    struct Traversal {
+        static constexpr int SEATS = NumPlayers > 0 ? NumPlayers : MAX_PLAYERS;
+        using Utilities = std::array<double, SEATS>;
+        // Probabilité d'atteinte de chaque joueur, puis celle du hasard (dernier élément),
+        // qui compte parmi les "adversaires" dans la pondération des regrets.
+        using Reach = std::array<double, SEATS + 1>;
+    };
+
     // Méthode CFR récursive principale.
-    // player_reach_probs: vecteur des probabilités que chaque joueur atteigne cet état.
-    // P0_reach_prob, P1_reach_prob, ...
-    // Returns: La valeur (EV) de l'état pour le joueur dont c'est le tour.
-    double cfr_traverse(GameState current_state, std::vector<double>& player_reach_probs, int iteration_num);
+    // Returns: l'utilité de l'état pour chaque joueur ; le regret d'un nœud utilise la
+    // composante du joueur qui agit.
+    template <int NumPlayers>
+    typename Traversal<NumPlayers>::Utilities cfr_traverse(TraversalContext& ctx, GameState current_state,
+                                                           typename Traversal<NumPlayers>::Reach& player_reach_probs,
+                                                           int iteration_num);
+
+    // Nœud de hasard explicite (voir BoardChance).
+    template <int NumPlayers>
+    typename Traversal<NumPlayers>::Utilities chance_traverse(TraversalContext& ctx, const GameState& state,
+                                                              typename Traversal<NumPlayers>::Reach& player_reach_probs,
+                                                              int iteration_num);
+
+    // ENUMERATE en parallèle (river) : un sous-arbre par issue, répartis entre chance_threads threads.
+    template <int NumPlayers>
+    typename Traversal<NumPlayers>::Utilities parallel_chance_traverse(TraversalContext& ctx, const GameState& state,
+                                                                       const std::vector<ChanceOutcome>& outcomes,
+                                                                       const typename Traversal<NumPlayers>::Reach& player_reach_probs,
+                                                                       int iteration_num);
+
+    // Itération PCS : tire la fin du board, puis une passe par joueur mis à jour (mises à jour alternées).
+    void run_pcs_iteration(TraversalContext& ctx, const GameState& initial_state, int iteration_num);
+
+    // Écrit dans values (NUM_HOLE_COMBOS), pour chaque main de update_player, sa valeur
+    // contrefactuelle en jetons (moyenne sur les mains adverses, pondérée par reach[adversaire]).
+    // Tampons par nœud dans ctx.scratch, actions légales par get_legal_actions.
+    void pcs_traverse(TraversalContext& ctx, GameState current_state, int update_player,
+                      const std::array<std::span<const double>, 2>& reach, const BoardRanking& ranking,
+                      int iteration_num, std::span<double> values);
+
+    InformationSet& find_or_create_infoset(TraversalContext& ctx, const std::string& infoset_key);
+
+    // Actions légales de state : lues dans legal_action_cache_ (config_.cache_legal_actions),
+    // sinon générées dans un tampon de frame.
+    std::span<const Action> get_legal_actions(TraversalContext& ctx, const GameState& state,
+                                              ScratchArena::Frame& frame) const;
+
+    // Clé d'infoset de player en state selon config_.transpositions (hole_cards vide : partie publique, PCS).
+    std::string make_infoset_key(const TraversalContext& ctx, const GameState& state, int player,
+                                 const std::vector<Card>& hole_cards) const;
+
+    // Vrai si l'élagage par regret est actif pour cette itération.
+    bool is_pruning_iteration(int iteration_num) const;
+
+    // Impute le temps écoulé depuis le dernier appel à la street en cours,
+    // puis bascule sur next_street (si enable_street_timing).
+    void switch_timed_street(TraversalContext& ctx, Street next_street) const;
 
     InformationSetMap infoset_map_;
     const ActionAbstraction& action_abstraction_; // Référence à une abstraction constante
-
-    // Historique des actions pour la main courante (utile pour générer la clé d'infoset)
-    // Est vidé au début de chaque nouvelle main dans run_iterations.
-    std::vector<Action> current_hand_action_history_;
+    CFREngineConfig config_;
+    int iteration_count_ = 0;
+    CFRMetrics metrics_;
+    Rng rng_;
+    std::unique_ptr<LegalActionCache> legal_action_cache_; // Si config_.cache_legal_actions
 };
 
 } // namespace gto_solver
@@ -0,0 +1,58 @@
+#ifndef GTO_CFR_METRICS_H
+#define GTO_CFR_METRICS_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace gto_solver {
+
+// Compteurs de performance du moteur CFR (cumulés depuis la construction ou le
+// dernier CFREngine::reset_metrics). Les champs "instantané" décrivent la table
+// d'infosets au moment de l'appel à CFREngine::get_metrics.
+struct CFRMetrics {
+    long long iterations = 0;
+    double training_seconds = 0.0;     // Temps passé dans run_iterations
+    long long nodes_visited = 0;       // Appels à cfr_traverse
+    long long terminal_evaluations = 0;
+    long long chance_nodes = 0;        // Nœuds de hasard explicites traversés
+    long long hand_evaluations = 0;    // Appels à l'évaluateur 7 cartes
+    long long infoset_lookups = 0;
+    long long infoset_hits = 0;        // Infoset déjà présent dans la table
+    long long pruned_branches = 0;
+    long long reach_pruned_subtrees = 0; // Sous-arbres sautés (probabilité d'atteinte adverse nulle)
+    long long legal_action_lookups = 0;  // Requêtes au cache d'actions légales (si activé)
+    long long legal_action_hits = 0;
+    long long regret_rescales = 0;       // Infosets INT32_SCALED divisés par 2 sur dépassement
+    // Temps exclusif passé dans les nœuds de chaque street, indexé par Street.
+    // Rempli seulement si CFREngineConfig::enable_street_timing ; cumulé sur les
+    // threads quand les nœuds de hasard sont énumérés en parallèle.
+    std::array<double, 5> street_seconds{};
+
+    // Instantané de la table
+    size_t infoset_count = 0;
+    size_t infoset_buckets = 0;
+    double infoset_load_factor = 0.0;
+    size_t regret_storage_bytes = 0;
+    size_t strategy_storage_bytes = 0;
+
+    double nodes_per_second() const { return training_seconds > 0.0 ? nodes_visited / training_seconds : 0.0; }
+    double iterations_per_second() const { return training_seconds > 0.0 ? iterations / training_seconds : 0.0; }
+    double infoset_hit_rate() const { return infoset_lookups > 0 ? static_cast<double>(infoset_hits) / infoset_lookups : 0.0; }
+    double legal_action_hit_rate() const {
+        return legal_action_lookups > 0 ? static_cast<double>(legal_action_hits) / legal_action_lookups : 0.0;
+    }
+
+    // Accumule les compteurs d'un autre relevé (les champs instantanés ne sont pas sommés).
+    CFRMetrics& operator+=(const CFRMetrics& other);
+
+    // Objet JSON sur une seule ligne (format JSON lines), sans retour à la ligne final.
+    std::string to_json() const;
+};
+
+// Ajoute metrics.to_json() en fin de fichier, suivi d'un retour à la ligne.
+bool append_metrics_json_line(const std::string& filename, const CFRMetrics& metrics);
+
+} // namespace gto_solver
+
+#endif // GTO_CFR_METRICS_H
@@ -0,0 +1,35 @@
+#ifndef GTO_CHANCE_H
+#define GTO_CHANCE_H
+
+#include "core/cards.hpp"
+#include "core/bitboard.hpp"
+#include "core/rng.hpp"
+#include <vector>
+
+namespace gto_solver {
+
+// Issue d'un nœud de hasard (une carte de board) et sa probabilité.
+struct ChanceOutcome {
+    Card card;
+    double probability;
+};
+
+// Toutes les cartes pouvant sortir à un nœud de hasard.
+// known_cards: cartes visibles dans l'état (board, mains distribuées) ; elles sont exclues.
+// suit_isomorphic: deux couleurs dont les cartes connues ont exactement les mêmes rangs
+// sont interchangeables (la permutation laisse l'état invariant) ; seules les cartes d'une
+// couleur de chaque classe sont retournées, avec la probabilité de toute la classe.
+// Les clés d'infoset ne sont pas canoniques par couleur : avec rng, la couleur représentante
+// est tirée uniformément à chaque appel, si bien que chaque carte de la classe est visitée
+// avec sa probabilité réelle en espérance. Sans rng, la plus petite couleur représente
+// toujours la classe (les infosets des autres couleurs ne sont alors jamais visités).
+// La somme des probabilités vaut 1.
+std::vector<ChanceOutcome> enumerate_chance_outcomes(Bitboard known_cards, bool suit_isomorphic,
+                                                     Rng* rng = nullptr);
+
+// Une carte uniforme hors de known_cards.
+Card sample_chance_outcome(Bitboard known_cards, Rng& rng);
+
+} // namespace gto_solver
+
+#endif // GTO_CHANCE_H
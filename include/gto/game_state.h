@@ -37,10 +37,21 @@ enum class Street {
     SHOWDOWN // Ou POST_RIVER
 };
 
+// Nombre maximal de joueurs à une table (tableaux de taille fixe par joueur).
+constexpr int MAX_PLAYERS = 9;
+
+// Pot (principal ou secondaire) : montant et joueurs non couchés pouvant le gagner.
+struct SidePot {
+    int amount = 0;
+    std::vector<int> eligible_players;
+};
+
 class GameState {
 public:
     // Constructeur (basé sur l'utilisation dans le test)
     GameState(int num_players, int initial_stack, int ante, int button_pos, int big_blind_size);
+    // Stacks de départ différents par joueur (tables réelles, pots secondaires).
+    GameState(const std::vector<int>& initial_stacks, int ante, int button_pos, int big_blind_size);
     virtual ~GameState();
 
     // Méthodes publiques (basées sur l'utilisation dans action_abstraction.cpp et le test)
@@ -49,6 +60,8 @@ public:
     const std::vector<int>& get_current_bets() const; // Ou retourne une copie?
     int get_pot_size() const;
     int get_last_raise_size() const;
+    // Relances (RAISE) déjà faites dans la street courante ; les blinds ne comptent pas.
+    int get_street_raise_count() const { return street_raise_count_; }
     int get_num_active_players() const; // Utilisé dans le calcul PCT_POT
     void apply_action(const Action& action);
     Street get_current_street() const;
@@ -58,11 +71,50 @@ public:
     bool is_player_folded(int player_index) const;
     int get_num_players() const;
     int get_big_blind_size() const;
+    // Total misé par le joueur depuis le début de la main (antes et blinds compris).
+    int get_player_contribution(int player_index) const;
+    // Pot principal puis pots secondaires, construits à partir des contributions : un pot
+    // par niveau de mise des joueurs non couchés (all-in plus courts), les mises des joueurs
+    // couchés étant réparties dans les niveaux qu'elles atteignent. Somme = get_pot_size().
+    std::vector<SidePot> get_side_pots() const;
 
     // Méthode pour obtenir les actions légales selon une abstraction donnée
     std::vector<Action> get_legal_abstract_actions(const ActionAbstraction& abstraction) const;
-
-    // Méthode pour obtenir les cartes restantes dans le deck
+    void get_legal_abstract_actions(const ActionAbstraction& abstraction, std::vector<Action>& actions) const;
+
+    // Remélange le deck avec rng et redistribue les cartes privées (chance sampling).
+    // Uniquement avant la première carte de board ; lève std::logic_error sinon.
+    void redeal(Rng& rng);
+    // Retire les cartes privées (INVALID_CARD) : parcours où les mains sont portées par
+    // des ranges et non par l'état. Le board doit alors être fourni par deal_board_card.
+    void clear_private_cards();
+
+    // --- Nœuds de hasard explicites ---
+    // En mode explicite, les cartes de board ne sont plus tirées du deck au changement
+    // de street : l'état devient un nœud de hasard (is_chance_node) jusqu'à ce que
+    // deal_board_card ait fourni les get_pending_board_cards() cartes attendues.
+    // Un all-in fait aussi dérouler le board jusqu'à la river par des nœuds de hasard.
+    // Lève std::logic_error si l'état est déjà un nœud de hasard.
+    void set_explicit_chance_nodes(bool enabled);
+    bool is_chance_node() const { return pending_board_cards_ > 0; }
+    int get_pending_board_cards() const { return pending_board_cards_; }
+    // Ajoute une carte au board. Lève std::logic_error hors nœud de hasard et
+    // std::invalid_argument si la carte est déjà visible.
+    void deal_board_card(Card card);
+    // Fin de main : ni nœud de hasard ni joueur à agir (ou showdown atteint).
+    bool is_terminal() const;
+
+    // Cartes ni en main ni au board (masque : aucune allocation).
+    Bitboard get_remaining_deck_mask() const;
+
+    // Hachage canonique de l'état public : street, joueur à agir, pot, stacks, mises,
+    // contributions, joueurs couchés, dernière relance, dernier agresseur et nombre de
+    // relances de la street, board (comme
+    // ensemble), nœud de hasard en cours. Deux états de même hachage ont la même suite de
+    // partie quelle que soit la séquence d'actions qui y a mené (transpositions).
+    // Les cartes privées n'y entrent pas.
+    uint64_t public_state_hash() const;
+    // Même ensemble, sous forme de vecteur trié.
     std::vector<Card> get_remaining_deck_cards() const;
 
     // Méthodes de test (placeholders)
@@ -98,9 +150,15 @@ private:
     int board_cards_dealt_;
     std::vector<bool> has_folded_; // Taille [num_players]
     int last_aggressor_index_;
+    std::vector<int> contributions_; // Total investi par joueur sur toute la main
+    bool explicit_chance_ = false;
+    int pending_board_cards_ = 0;    // Cartes de board attendues (nœud de hasard)
+    bool runout_to_showdown_ = false; // Board déroulé après un all-in
+    int street_raise_count_ = 0;
     // ... autres états ...
 
     // Méthodes privées
+    void deal_hole_cards();
     void progress_to_next_street();
     std::string board_to_string() const;
     bool is_betting_round_over() const;
@@ -0,0 +1,82 @@
+#ifndef GTO_HAND_RANGE_H
+#define GTO_HAND_RANGE_H
+
+#include "core/cards.hpp"
+#include "core/bitboard.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace gto_solver {
+
+// Nombre de mains privées (2 cartes) distinctes : C(52, 2).
+constexpr int NUM_HOLE_COMBOS = 1326;
+
+struct HoleCombo {
+    Card c1; // c1 < c2
+    Card c2;
+    Bitboard mask() const { return (1ULL << c1) | (1ULL << c2); }
+};
+
+// Table des 1326 combos, triée par (c1, c2). L'index dans cette table est
+// l'index utilisé par tous les vecteurs de range.
+const std::array<HoleCombo, NUM_HOLE_COMBOS>& all_hole_combos();
+
+// Index d'un combo (ordre des cartes indifférent). Retourne -1 si invalide.
+int combo_index(Card a, Card b);
+
+// "Xx-Yy" pour chaque combo : partie main privée des clés d'infoset (InformationSet::generate_key).
+const std::array<std::string, NUM_HOLE_COMBOS>& hole_combo_strings();
+
+// Un vecteur de poids (probabilité d'atteinte, valeur...) par combo.
+using RangeVector = std::vector<double>;
+
+// Range uniforme, combos en conflit avec dead_cards mis à 0.
+RangeVector make_uniform_range(Bitboard dead_cards = EMPTY_BOARD);
+
+// Met à 0 les combos qui contiennent une carte de dead_cards.
+void remove_blocked_combos(RangeVector& range, Bitboard dead_cards);
+
+// Valeur (contrefactuelle) d'un nœud de fold pour chaque main du joueur :
+// out[h] = payoff * somme des poids adverses compatibles avec h (sans carte commune).
+// Calculé en O(1326) grâce à l'inclusion-exclusion sur les cartes.
+void fold_values(const RangeVector& opp_reach, double payoff, RangeVector& out);
+// Idem dans un tampon fourni (NUM_HOLE_COMBOS valeurs) : aucune allocation.
+void fold_values(std::span<const double> opp_reach, double payoff, std::span<double> out);
+
+// Combos valides (rang != INVALID_HAND_RANK) triés du plus fort au plus faible.
+// hand_ranks: rang de chaque combo sur le board (plus petit = meilleur, convention
+// de l'évaluateur), INVALID_HAND_RANK pour les combos bloqués par le board.
+// À calculer une seule fois par board puis à réutiliser à chaque nœud de showdown.
+std::vector<int> sort_combos_by_strength(const std::vector<uint16_t>& hand_ranks);
+
+// Valeur d'un showdown pour chaque main du joueur :
+// out[h] = stake * (poids adverses battus - poids adverses gagnants), compatibles avec h.
+// Deux balayages linéaires de sorted_combos (voir sort_combos_by_strength).
+void showdown_values(const RangeVector& opp_reach,
+                     const std::vector<uint16_t>& hand_ranks,
+                     const std::vector<int>& sorted_combos,
+                     double stake,
+                     RangeVector& out);
+void showdown_values(std::span<const double> opp_reach,
+                     const std::vector<uint16_t>& hand_ranks,
+                     const std::vector<int>& sorted_combos,
+                     double stake,
+                     std::span<double> out);
+
+// Force de tous les combos sur un board complet, calculée une fois par board.
+struct BoardRanking {
+    std::array<Card, 5> board{};
+    Bitboard board_mask = EMPTY_BOARD;
+    std::vector<uint16_t> hand_ranks; // INVALID_HAND_RANK pour les combos bloqués
+    std::vector<int> sorted_combos;   // Voir sort_combos_by_strength
+    int valid_combos = 0;             // Combos évalués (compatibles avec le board)
+};
+
+BoardRanking rank_hole_combos(const std::array<Card, 5>& board);
+
+} // namespace gto_solver
+
+#endif // GTO_HAND_RANGE_H
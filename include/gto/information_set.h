@@ -4,49 +4,103 @@
 #include "gto/action_abstraction.h" // Pour Action
 #include "core/cards.hpp"           // Pour Card
 #include "gto/game_state.h"         // Pour Street (et potentiellement d'autres infos de GameState)
+#include "core/rng.hpp"             // Pour Rng (arrondi stochastique)
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
-#include <map> // Pourra être remplacé par unordered_map si performance critique
+#include <unordered_map>
 #include <numeric> // Pour std::iota, std::accumulate
 #include <algorithm> // Pour std::transform, std::max
 #include <sstream>   // Pour la génération de clé
 
 namespace gto_solver {
 
+// Précision de stockage des regrets cumulés.
+// INT32_SCALED : entiers 32 bits (regret * regret_scale), comme Pluribus. Les regrets
+// négatifs saturent au plancher ; un dépassement positif divise par 2 tous les regrets
+// de l'infoset ainsi que l'incrément en cours (la stratégie de regret matching est
+// invariante par homothétie). Ces remises à l'échelle sont comptées dans
+// CFRMetrics::regret_rescales.
+enum class RegretStorage : uint8_t { DOUBLE, INT32_SCALED };
+
+// Précision de stockage de la stratégie cumulée (somme des stratégies pondérées).
+// En cas de dépassement, toutes les sommes de l'infoset sont divisées par 2
+// (la stratégie moyenne, normalisée, est inchangée).
+enum class StrategyStorage : uint8_t { DOUBLE, FLOAT32, FLOAT16 };
+
+struct StoragePrecision {
+    RegretStorage regrets = RegretStorage::DOUBLE;
+    StrategyStorage strategy = StrategyStorage::DOUBLE;
+    // Unités entières par jeton pour RegretStorage::INT32_SCALED.
+    double regret_scale = 1000.0;
+
+    size_t regret_bytes() const { return regrets == RegretStorage::DOUBLE ? sizeof(double) : sizeof(int32_t); }
+    size_t strategy_bytes() const {
+        switch (strategy) {
+            case StrategyStorage::DOUBLE:  return sizeof(double);
+            case StrategyStorage::FLOAT32: return sizeof(float);
+            case StrategyStorage::FLOAT16: return sizeof(uint16_t);
+        }
+        return sizeof(double);
+    }
+    // Octets de stockage par action (regret + somme de stratégie).
+    size_t bytes_per_action() const { return regret_bytes() + strategy_bytes(); }
+
+    bool operator==(const StoragePrecision&) const = default;
+};
+
 class InformationSet {
 public:
     // Clé unique identifiant ce nœud d'information.
     // Format: "[P<player_idx>]<HoleCards>|<BoardCards>|<Street>|<ActionHistory>"
     std::string key;
 
-    // Regrets cumulés pour chaque action possible depuis cet infoset.
-    // La taille correspond au nombre d'actions légales à ce nœud.
-    std::vector<double> cumulative_regrets;
-
-    // Stratégie cumulée (somme des stratégies de chaque itération où les regrets étaient positifs).
-    // Utilisée pour calculer la stratégie moyenne finale.
-    std::vector<double> cumulative_strategy;
-
     // Nombre de fois que ce nœud a été visité (utile pour certaines variantes de CFR ou debug).
     int visit_count = 0;
 
+    // Vrai si regrets/stratégie ont changé depuis le dernier checkpoint (complet ou delta).
+    // Permet aux checkpoints incrémentaux de n'écrire que les infosets touchés.
+    bool dirty = false;
+
 public:
     InformationSet() = default; // Constructeur par défaut
 
     // Initialise un nœud d'information avec le nombre d'actions légales possibles.
-    void initialize(size_t num_actions);
+    void initialize(size_t num_actions, const StoragePrecision& precision = {});
+
+    size_t num_actions() const { return num_actions_; }
+    // Descripteur partagé : l'infoset n'en garde qu'un index d'un octet (voir precision_id_).
+    const StoragePrecision& precision() const;
+    // Octets occupés par les regrets et la stratégie cumulée de cet infoset.
+    size_t storage_bytes() const { return data_.size(); }
+
+    // Accès aux regrets cumulés (convertis depuis/vers la précision de stockage).
+    double get_regret(size_t action_index) const;
+    // Retourne vrai si un dépassement INT32 a imposé une remise à l'échelle de l'infoset.
+    bool add_regret(size_t action_index, double delta);
+    void set_regret(size_t action_index, double value);
+
+    // Accès à la stratégie cumulée.
+    double get_strategy_sum(size_t action_index) const;
+    // rng : générateur de la traversée, pour l'arrondi stochastique des sommes FLOAT32 /
+    // FLOAT16 (le résultat ne dépend alors ni du thread ni de l'ordre de création des threads).
+    void add_strategy_sum(size_t action_index, double delta, Rng& rng);
+    void set_strategy_sum(size_t action_index, double value);
 
     // Calcule la stratégie actuelle basée sur les regrets positifs.
     // Retourne un vecteur de probabilités pour chaque action.
     std::vector<double> get_current_strategy() const;
+    // Idem, écrite dans out (num_actions() éléments) : sans allocation.
+    void get_current_strategy(std::span<double> out) const;
 
     // Met à jour les regrets et la stratégie cumulée.
     // strategy_profile: la stratégie effectivement jouée à cette itération (peut être la stratégie actuelle).
     // action_values: la valeur (EV) de chaque action depuis cet état.
     // current_player_reach_probability: probabilité que le joueur courant atteigne cet état.
-    void update_regrets(const std::vector<double>& action_values, double node_value);
+    void update_regrets(std::span<const double> action_values, double node_value);
     
-    void update_strategy_sum(const std::vector<double>& current_strategy_profile);
+    void update_strategy_sum(std::span<const double> current_strategy_profile, Rng& rng);
 
     // Génère une clé unique pour un état de jeu donné du point de vue d'un joueur.
     static std::string generate_key(
@@ -58,13 +112,42 @@ public:
         const std::vector<Action>& action_history // L'historique des actions de la main
         // TODO: Ajouter potentiellement les mises actuelles / pot si pas implicite dans action_history
     );
+
+    // Variante pour les transpositions : l'historique est remplacé par le hachage de l'état
+    // public (GameState::public_state_hash), "#<16 chiffres hexadécimaux>". Les séquences
+    // menant au même état public partagent alors l'infoset (abstraction sans mémoire parfaite).
+    static std::string generate_transposition_key(
+        int player_index,
+        const std::vector<Card>& hole_cards,
+        const std::array<Card, 5>& board,
+        int board_cards_dealt,
+        Street current_street,
+        uint64_t public_state_hash
+    );
+
+private:
+    // Index du descripteur dans une table partagée par tous les infosets (quelques
+    // précisions distinctes par processus) : un octet au lieu d'un StoragePrecision
+    // complet par infoset. 0 : précision par défaut.
+    uint8_t precision_id_ = 0;
+    uint32_t num_actions_ = 0;
+    // Stockage compact : [regrets (num_actions_) | stratégie cumulée (num_actions_)].
+    // Accès via memcpy : l'alignement dépend de la précision choisie.
+    std::vector<uint8_t> data_;
+
+    uint8_t* regret_ptr(size_t i);
+    const uint8_t* regret_ptr(size_t i) const;
+    uint8_t* strategy_ptr(size_t i);
+    const uint8_t* strategy_ptr(size_t i) const;
+    void rescale_regrets(double factor);
+    void rescale_strategy_sums(double factor);
 };
 
 // Map pour stocker tous les nœuds d'information rencontrés.
 // La clé est la string générée par InformationSet::generate_key.
-using InformationSetMap = std::map<std::string, InformationSet>;
-// Pourrait être: using InformationSetMap = std::unordered_map<std::string, InformationSet>;
-// avec une fonction de hash custom pour std::string si performance devient un enjeu.
+// Table de hachage : accès O(1) dans la traversée ; l'ordre d'itération (et donc
+// l'ordre des lignes dans les checkpoints) n'est pas garanti.
+using InformationSetMap = std::unordered_map<std::string, InformationSet>;
 
 } // namespace gto_solver
 
@@ -0,0 +1,71 @@
+#ifndef GTO_LEGAL_ACTION_CACHE_H
+#define GTO_LEGAL_ACTION_CACHE_H
+
+#include "gto/action_abstraction.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace gto_solver {
+
+class GameState;
+
+// Partie de l'état de mise dont dépendent les actions abstraites du joueur qui agit.
+// Les cartes (privées et board) n'y figurent pas : tous les nœuds d'une même ligne
+// de mises partagent leurs actions, quelle que soit la donne.
+struct PublicBettingKey {
+    int8_t street = 0;
+    int8_t player = -1;
+    bool player_folded = false;
+    int32_t player_stack = 0;
+    int32_t player_bet = 0;
+    int32_t max_bet = 0;
+    int32_t pot = 0;
+    int32_t last_raise = 0;
+    int32_t big_blind = 0;
+    int32_t raise_count = 0; // Niveau de relance (tailles par niveau de ActionAbstraction)
+
+    static PublicBettingKey from_state(const GameState& state);
+    bool operator==(const PublicBettingKey&) const = default;
+    uint64_t hash() const;
+};
+
+// Cache des actions légales d'une abstraction, indexé par PublicBettingKey. Utilisable
+// depuis plusieurs threads : table répartie en segments, chacun protégé par un verrou
+// lecteurs/écrivain (lectures concurrentes, écriture seulement au premier calcul d'une clé).
+// Les listes sont immuables et ne sont jamais déplacées : les vues retournées restent
+// valides jusqu'à clear() (à n'appeler qu'en dehors de toute traversée).
+class LegalActionCache {
+public:
+    explicit LegalActionCache(const ActionAbstraction& action_abstraction);
+    LegalActionCache(const LegalActionCache&) = delete;
+    LegalActionCache& operator=(const LegalActionCache&) = delete;
+
+    // Actions légales de state (identiques à ActionAbstraction::get_abstract_actions).
+    // hit : vrai si la liste était déjà en cache.
+    std::span<const Action> get(const GameState& state, bool* hit = nullptr);
+
+    size_t size() const;
+    void clear();
+
+private:
+    struct KeyHash {
+        size_t operator()(const PublicBettingKey& key) const { return static_cast<size_t>(key.hash()); }
+    };
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<PublicBettingKey, std::vector<Action>, KeyHash> lists;
+    };
+    static constexpr size_t NUM_SHARDS = 64;
+
+    const ActionAbstraction& action_abstraction_;
+    std::array<Shard, NUM_SHARDS> shards_;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_LEGAL_ACTION_CACHE_H
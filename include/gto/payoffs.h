@@ -0,0 +1,39 @@
+#ifndef GTO_PAYOFFS_H
+#define GTO_PAYOFFS_H
+
+#include "gto/game_state.h"
+#include "eval/hand_evaluator.hpp" // Pour HandRank
+#include "core/rng.hpp"
+#include <array>
+
+namespace gto_solver {
+
+// Utilité de chaque joueur (jetons nets : gains moins contribution), indexée par joueur.
+// Taille fixe : aucune allocation par nœud terminal. Cases >= get_num_players() à 0.
+using UtilityVector = std::array<double, MAX_PLAYERS>;
+
+// Répartition des pots (principal et secondaires) au showdown, board complet.
+// hand_ranks[p] : rang 7 cartes du joueur p (plus petit = meilleur), ignoré s'il est couché.
+// Les joueurs en main sont triés une seule fois par rang ; chaque pot revient aux
+// meilleurs éligibles et est partagé à parts égales en cas d'égalité.
+UtilityVector showdown_utilities(const GameState& state, const std::array<HandRank, MAX_PLAYERS>& hand_ranks);
+
+// Utilités à un nœud terminal : un seul joueur en main (pas d'évaluation), showdown sur
+// board complet, ou board incomplet (all-in sans nœuds de hasard explicites) : moyenne
+// exacte sur tous les runouts restants. hand_evaluations est incrémenté du nombre
+// d'évaluations 7 cartes effectuées.
+// Avec rng et max_runouts > 0, s'il reste plus de max_runouts runouts, la moyenne porte sur
+// max_runouts runouts tirés uniformément (avec remise) : estimation sans biais, coût borné
+// (un all-in préflop en laisse 1 712 304 sans board, ~1 000 après le flop).
+UtilityVector terminal_utilities(const GameState& state, long long& hand_evaluations,
+                                 Rng* rng = nullptr, int max_runouts = 0);
+
+// Chemin rapide heads-up : utilité de P0 (celle de P1 est son opposé). Fold ou showdown sur
+// board complet sans tri ni pots secondaires (enjeu = plus petite contribution) ; board
+// incomplet : terminal_utilities (mêmes rng et max_runouts).
+double heads_up_terminal_utility(const GameState& state, long long& hand_evaluations,
+                                 Rng* rng = nullptr, int max_runouts = 0);
+
+} // namespace gto_solver
+
+#endif // GTO_PAYOFFS_H
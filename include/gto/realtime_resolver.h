@@ -0,0 +1,89 @@
+#ifndef GTO_REALTIME_RESOLVER_H
+#define GTO_REALTIME_RESOLVER_H
+
+#include "gto/subgame_solver.h"
+#include "gto/action_translation.h"
+#include "gto/cfr_engine.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include "gto/hand_range.h"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace gto_solver {
+
+struct RealtimeResolverConfig {
+    // Budget par décision : 0,5 s sans limite d'itérations (profondeur : street courante).
+    SubgameSolverConfig subgame{0, 0, 0.5};
+    // Feuilles évaluées par rollout du blueprint (4 continuations) plutôt que par l'équité.
+    // Sans effet à la river : le sous-jeu n'a pas de feuille.
+    bool blueprint_leaves = true;
+    int rollout_boards = 1;
+    // Poids du warm-start, en itérations équivalentes (voir SubgameSolver::warm_start ; 0 : désactivé).
+    double warm_start_weight = 10.0;
+    // Action abstraite retenue pour une action hors arbre (historique des clés du blueprint).
+    TranslationMode translation_mode = TranslationMode::DETERMINISTIC;
+    uint64_t translation_seed = DEFAULT_RNG_SEED; // Mode RANDOMIZED : mêmes tirages à chaque appel
+};
+
+struct ResolveResult {
+    std::vector<Action> actions;           // Actions de l'abstraction au nœud résolu
+    std::array<RangeVector, 2> ranges;     // Ranges déduites par Bayes du blueprint
+    SubgameSolveResult solve;
+    size_t warm_started_infosets = 0;
+    double total_seconds = 0.0;            // Déduction des ranges, construction et résolution
+};
+
+// Re-résolution en temps réel d'un spot heads-up à partir d'une stratégie blueprint
+// (checkpoint CFREngine). Les ranges sont déduites en rejouant l'historique : chaque
+// action réelle multiplie la range de son auteur par la probabilité blueprint de ses
+// actions abstraites voisines (traduction pseudo-harmonique des tailles hors arbre), et
+// les clés du blueprint suivent l'historique traduit dans l'abstraction.
+// Le sous-jeu (SubgameSolver) est ensuite warm-starté depuis les regrets et
+// stratégies moyennes du blueprint.
+class RealtimeResolver {
+public:
+    explicit RealtimeResolver(const ActionAbstraction& action_abstraction,
+                              const RealtimeResolverConfig& config = {});
+    RealtimeResolver(const RealtimeResolver&) = delete;
+    RealtimeResolver& operator=(const RealtimeResolver&) = delete;
+
+    // Charge un checkpoint (CFREngine::save_infoset_map). false en cas d'échec.
+    bool load_blueprint(const std::string& filename);
+    const CFREngine& get_blueprint() const { return blueprint_; }
+
+    // Ranges des deux joueurs en current_state, obtenues en rejouant action_history
+    // depuis initial_state (cartes privées ignorées, board lu dans current_state).
+    // Chaque action est traduite dans une partie abstraite rejouée en parallèle ;
+    // abstract_history (si non nul) reçoit ces actions traduites, historique des clés du
+    // blueprint. Lève std::invalid_argument si l'historique ne mène pas au nœud de current_state.
+    std::array<RangeVector, 2> derive_ranges(const GameState& initial_state,
+                                             const std::vector<Action>& action_history,
+                                             const GameState& current_state,
+                                             std::vector<Action>* abstract_history = nullptr) const;
+
+    // Déduit les ranges, construit et résout le sous-jeu en current_state. Le sous-jeu est
+    // construit sur l'historique traduit : warm-start et feuilles retrouvent les clés du
+    // blueprint même après une taille hors arbre.
+    ResolveResult resolve(const GameState& initial_state,
+                          const std::vector<Action>& action_history,
+                          const GameState& current_state);
+
+    // Stratégie résolue (ordre de ResolveResult::actions) pour une main donnée.
+    std::vector<double> get_strategy(Card c1, Card c2) const;
+
+private:
+    const ActionAbstraction& action_abstraction_;
+    RealtimeResolverConfig config_;
+    ActionTranslator translator_;
+    CFREngine blueprint_;
+    EquityLeafEstimator equity_leaves_;
+    BlueprintLeafEstimator blueprint_leaves_;
+    SubgameSolver solver_;
+    bool solved_ = false;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_REALTIME_RESOLVER_H
@@ -0,0 +1,67 @@
+#ifndef GTO_SOLVER_CONFIG_H
+#define GTO_SOLVER_CONFIG_H
+
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include "gto/cfr_engine.h"
+#include "gto/training_scheduler.h"
+#include "gto/tree_estimator.h"
+#include "core/ini_file.hpp"
+#include "spdlog/spdlog.h"
+#include <string>
+#include <vector>
+
+namespace gto_solver {
+
+// Partie à résoudre.
+struct GameConfig {
+    int num_players = 2;
+    int initial_stack = 200;
+    std::vector<int> stacks; // Stacks par siège ; vide : initial_stack pour tous
+    int ante = 0;
+    int button_pos = 0;
+    int big_blind = 2;
+
+    GameState make_initial_state() const;
+};
+
+// Configuration complète d'un run de l'exécutable solver : chaque job d'une ferme de
+// calcul lance le même binaire avec son propre fichier (et ses surcharges --section.cle).
+struct SolverConfig {
+    GameConfig game;
+    ActionAbstractionConfig abstraction = default_abstraction();
+    CFREngineConfig engine;
+    TrainingSchedulerConfig training = default_training();
+    TreeEstimatorConfig estimator = default_estimator();
+    bool estimate_tree = true;  // Estimation de l'arbre avant l'entraînement
+    bool estimate_only = false; // S'arrêter après l'estimation
+    std::string infoset_file = "infoset_map.dat"; // Chargé au démarrage, sauvegardé à la fin
+    spdlog::level::level_enum log_level = spdlog::level::info; // [log] level : trace ... off
+
+    // Sections [game], [engine], [storage], [training], [checkpoint], [estimator], [log],
+    // et celles de ActionAbstraction::from_ini (qui remplacent alors l'abstraction par défaut).
+    // Valeurs absentes : valeurs par défaut ci-dessus. Lève std::invalid_argument pour une
+    // clé inconnue ou une valeur invalide.
+    static SolverConfig from_ini(const IniFile& ini);
+
+    // Abstraction historique de main.cpp (fractions, tailles BB et mises exactes par street).
+    static ActionAbstractionConfig default_abstraction();
+    static TrainingSchedulerConfig default_training();
+    static TreeEstimatorConfig default_estimator();
+};
+
+// Ligne de commande : --config <fichier> charge un fichier, --<section>.<cle>=<valeur>
+// (ou --<section>.<cle> <valeur>) surcharge une valeur ; raccourcis : --iterations,
+// --seconds, --threads, --seed, --output, --estimate-only, --help.
+struct CommandLine {
+    IniFile ini;
+    bool show_help = false;
+};
+
+// Lève std::invalid_argument pour un argument inconnu ou sans valeur.
+CommandLine parse_command_line(int argc, const char* const argv[]);
+std::string command_line_usage(const std::string& program_name);
+
+} // namespace gto_solver
+
+#endif // GTO_SOLVER_CONFIG_H
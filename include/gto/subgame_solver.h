@@ -0,0 +1,213 @@
+#ifndef GTO_SUBGAME_SOLVER_H
+#define GTO_SUBGAME_SOLVER_H
+
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include "gto/hand_range.h"
+#include "gto/information_set.h"
+#include "core/rng.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gto_solver {
+
+class CFREngine;
+
+// Demande de valeurs à un nœud feuille (frontière de profondeur du sous-jeu).
+struct LeafQuery {
+    const GameState& state;                     // Nœud de hasard à la frontière (board incomplet)
+    const std::vector<Action>& action_history;  // Depuis le début de la main (clés d'infoset)
+    int chooser;                                // Joueur qui choisit la continuation
+    int continuation;                           // Dans [0, num_continuations())
+    int player;                                 // Joueur dont on veut les valeurs
+    const RangeVector& opp_reach;               // Poids de chaque main adverse au nœud
+};
+
+// Estimation de la valeur du reste de la main à la frontière du sous-jeu.
+// Plusieurs continuations (multi-valued states) : à chaque feuille, le joueur
+// LeafQuery::chooser choisit une stratégie de continuation par main ; le sous-jeu
+// doit alors être robuste à tous ces choix.
+class LeafValueEstimator {
+public:
+    virtual ~LeafValueEstimator() = default;
+
+    virtual int num_continuations() const { return 1; }
+
+    // out[h] : valeur (jetons) de la main h de query.player, sommée sur les mains
+    // adverses compatibles pondérées par opp_reach (même convention que fold_values /
+    // showdown_values). 0 pour les mains bloquées par le board.
+    virtual void leaf_values(const LeafQuery& query, RangeVector& out) const = 0;
+};
+
+// Équité au showdown (check jusqu'à la river) sur les boards restants, calculée sur les
+// classements précalculés de chaque board complet (mis en cache au premier usage).
+// Exacte pour un all-in ; approximation sans jeu futur sinon. Non thread-safe (cache).
+class EquityLeafEstimator : public LeafValueEstimator {
+public:
+    // max_runouts: au-delà de ce nombre de boards restants, on en tire max_runouts
+    // (graine seed, toujours les mêmes). 0 : énumération complète jusqu'à 2 cartes à venir,
+    // DEFAULT_SAMPLED_RUNOUTS tirages au-delà.
+    explicit EquityLeafEstimator(int max_runouts = 0, uint64_t seed = DEFAULT_RNG_SEED);
+
+    void leaf_values(const LeafQuery& query, RangeVector& out) const override;
+
+    static constexpr int DEFAULT_SAMPLED_RUNOUTS = 1000;
+
+private:
+    // Boards complets prolongeant un board partiel, et facteur ramenant leur somme à
+    // l'espérance sur les boards compatibles avec une paire de mains donnée.
+    struct RunoutSet {
+        std::vector<std::array<Card, 5>> boards;
+        double scale = 1.0;
+    };
+
+    const BoardRanking& ranking_for(const std::array<Card, 5>& board) const;
+    const RunoutSet& runouts_for(const GameState& state) const;
+
+    int max_runouts_;
+    uint64_t seed_;
+    mutable std::unordered_map<Bitboard, BoardRanking> rankings_;
+    mutable std::unordered_map<Bitboard, RunoutSet> runouts_;
+};
+
+// Continuations tirées d'une stratégie blueprint (stratégies moyennes d'un CFREngine) :
+// 0 = blueprint, 1/2/3 = blueprint du chooser biaisé vers fold / call / raise (probabilités
+// multipliées par bias_factor puis renormalisées). L'autre joueur suit le blueprint.
+// Chaque appel déroule le reste de la main sur rollout_boards boards tirés (estimation non biaisée).
+class BlueprintLeafEstimator : public LeafValueEstimator {
+public:
+    BlueprintLeafEstimator(const CFREngine& blueprint,
+                           const ActionAbstraction& action_abstraction,
+                           int rollout_boards = 1,
+                           double bias_factor = 5.0,
+                           uint64_t seed = DEFAULT_RNG_SEED);
+
+    int num_continuations() const override { return 4; }
+    void leaf_values(const LeafQuery& query, RangeVector& out) const override;
+
+private:
+    RangeVector rollout(GameState state, std::vector<Action>& action_history, const LeafQuery& query,
+                        const std::array<RangeVector, 2>& reach, const BoardRanking& ranking) const;
+    void blueprint_strategy(const std::string& infoset_key, const std::vector<Action>& actions,
+                            bool biased, int continuation, std::vector<double>& out) const;
+
+    const CFREngine& blueprint_;
+    const ActionAbstraction& action_abstraction_;
+    int rollout_boards_;
+    double bias_factor_;
+    mutable Rng rng_;
+};
+
+struct SubgameSolverConfig {
+    // Streets explorées au-delà de celle de la racine (0 : street courante seulement).
+    // Les nœuds de hasard au-delà deviennent des feuilles évaluées par le LeafValueEstimator.
+    int max_street_depth = 0;
+    // Budget : arrêt au premier atteint (<= 0 : désactivé ; au moins un doit être actif).
+    int max_iterations = 1000;
+    double max_seconds = 0.0;
+    // Joueur qui choisit les continuations aux feuilles. -1 : adversaire du joueur à agir à la racine.
+    int leaf_chooser = -1;
+    // Regret matching+ (regrets planchers à 0, moyenne pondérée par l'itération) : convergence
+    // bien plus rapide pour les résolutions en temps limité. false : CFR vanilla.
+    bool regret_matching_plus = true;
+};
+
+struct SubgameSolveResult {
+    int iterations = 0;
+    double elapsed_seconds = 0.0;
+    size_t decision_nodes = 0;
+    size_t leaf_nodes = 0;
+    size_t storage_bytes = 0; // Regrets et stratégies cumulées
+};
+
+// Résolution heads-up d'un sous-jeu à profondeur limitée, à partir d'un état
+// quelconque et des ranges des deux joueurs. L'arbre public (actions de l'abstraction,
+// cartes de board énumérées) est construit une fois ; regrets et stratégies sont
+// stockés par nœud dans des tableaux plats [main][action] (CFR vectoriel sur 1326 combos).
+class SubgameSolver {
+public:
+    SubgameSolver(const ActionAbstraction& action_abstraction,
+                  const LeafValueEstimator& leaf_estimator,
+                  const SubgameSolverConfig& config = {});
+
+    // root_state: état de départ (cartes privées ignorées). action_history: actions depuis
+    // le début de la main (clés d'infoset compatibles avec CFREngine). ranges: poids de chaque
+    // combo pour chaque joueur (les combos bloqués par le board sont mis à 0).
+    // Lève std::invalid_argument hors heads-up ou sur un nœud terminal / de hasard.
+    void build(const GameState& root_state,
+               const std::vector<Action>& action_history,
+               const std::array<RangeVector, 2>& ranges);
+
+    // Warm-start depuis des infosets de même clé (blueprint CFREngine), à appeler après build().
+    // Chaque infoset trouvé compte pour iterations_equivalent itérations : regrets = regret moyen
+    // par visite (ramené à la masse de la range adverse), stratégies cumulées = stratégie moyenne
+    // pondérée par la range du joueur. Retourne le nombre de (nœud, main) initialisés.
+    size_t warm_start(const InformationSetMap& infosets, double iterations_equivalent = 10.0);
+
+    // Itère jusqu'à épuisement du budget. Lève std::logic_error si build n'a pas été appelé
+    // et std::invalid_argument si aucun budget n'est actif.
+    SubgameSolveResult solve();
+
+    // Actions légales à la racine et stratégie moyenne d'une main (index de combo).
+    const std::vector<Action>& get_root_actions() const;
+    std::vector<double> get_root_strategy(int combo) const;
+    // Stratégie moyenne au nœud atteint depuis la racine par actions_from_root (sans carte
+    // de board intermédiaire). Vide si le chemin ne mène pas à un nœud de décision.
+    std::vector<double> get_average_strategy(const std::vector<Action>& actions_from_root, int combo) const;
+
+    int get_root_player() const;
+    size_t get_node_count() const { return nodes_.size(); }
+
+private:
+    enum class NodeType { DECISION, CHANCE, FOLD, SHOWDOWN, LEAF, ALL_IN };
+
+    struct Node {
+        NodeType type = NodeType::DECISION;
+        int player = -1;                 // DECISION : joueur qui agit (y compris choix de continuation)
+        std::vector<Action> actions;     // DECISION (vide pour un choix de continuation)
+        std::vector<int> children;
+        std::vector<Card> chance_cards;  // CHANCE : carte menant à chaque enfant
+        double chance_weight = 0.0;      // CHANCE : 1 / cartes possibles pour deux mains données
+        std::string key_suffix;          // DECISION : partie publique de la clé d'infoset
+        Bitboard board_mask = EMPTY_BOARD; // DECISION : mains bloquées par le board
+        size_t offset = 0;               // DECISION : début dans regrets_ / strategy_sums_
+        std::array<int, 2> contributions{}; // FOLD / SHOWDOWN
+        int folded_player = -1;          // FOLD
+        int ranking = -1;                // SHOWDOWN : index dans rankings_
+        int leaf = -1;                   // LEAF / ALL_IN : index dans leaves_
+        int continuation = 0;            // LEAF
+    };
+
+    struct LeafData {
+        GameState state;
+        std::vector<Action> action_history;
+    };
+
+    int build_node(const GameState& state, std::vector<Action>& history, Street root_street);
+    int add_decision_node(int player, std::vector<Action> actions, std::string key_suffix);
+
+    RangeVector traverse(int node_id, int update_player, const std::array<RangeVector, 2>& reach, int iteration);
+    void current_strategy(const Node& node, int combo, double* out) const;
+
+    const ActionAbstraction& action_abstraction_;
+    const LeafValueEstimator& leaf_estimator_;
+    SubgameSolverConfig config_;
+    EquityLeafEstimator all_in_estimator_; // Runouts après all-in : équité exacte
+
+    std::vector<Node> nodes_;
+    std::vector<LeafData> leaves_;
+    std::vector<BoardRanking> rankings_;
+    std::unordered_map<Bitboard, int> ranking_index_;
+    std::vector<double> regrets_;
+    std::vector<double> strategy_sums_;
+    std::array<RangeVector, 2> root_ranges_;
+    int leaf_chooser_ = 1;
+    bool built_ = false;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_SUBGAME_SOLVER_H
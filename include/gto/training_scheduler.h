@@ -0,0 +1,103 @@
+#ifndef GTO_TRAINING_SCHEDULER_H
+#define GTO_TRAINING_SCHEDULER_H
+
+#include "gto/cfr_engine.h"
+#include "gto/best_response.h"
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include <functional>
+#include <string>
+
+namespace gto_solver {
+
+// Conditions d'arrêt de l'entraînement. Une valeur <= 0 désactive le critère ;
+// l'entraînement s'arrête dès que l'un des critères actifs est atteint.
+struct TrainingBudget {
+    double max_seconds = 0.0;               // Temps réel (wall-clock)
+    int max_iterations = 0;                 // Itérations effectuées par ce run
+    double target_exploitability_mbb = 0.0; // Nécessite enable_evaluation
+};
+
+struct TrainingSchedulerConfig {
+    TrainingBudget budget;
+
+    // --- Évaluation (meilleure réponse) ---
+    bool enable_evaluation = true; // Ignoré (avertissement) hors BestResponse::is_supported
+    int evaluation_chance_samples = 8; // Issues par nœud de hasard (BestResponse::compute)
+    int evaluation_threads = 0; // 0 : hardware_concurrency
+    // Part maximale du temps total consacrée à l'évaluation : l'intervalle entre deux
+    // évaluations est recalculé après chacune d'elles à partir de son coût mesuré.
+    double max_evaluation_time_fraction = 0.1;
+    int min_iterations_between_evaluations = 1;
+    int max_iterations_between_evaluations = 100000;
+
+    // --- Checkpoints ---
+    std::string checkpoint_file; // Vide : pas de checkpoint
+    double checkpoint_interval_seconds = 600.0;
+    // Après le premier checkpoint complet, n'écrire que les infosets modifiés
+    // dans checkpoint_file + ".delta" (voir CFREngine::save_infoset_delta).
+    bool use_delta_checkpoints = true;
+
+    // Fichier JSON lines : une ligne CFRMetrics (CFREngine::get_metrics) par lot. Vide : désactivé.
+    std::string metrics_file;
+
+    // Nombre maximal d'itérations entre deux vérifications du budget de temps. Le premier
+    // lot fait une itération, les suivants doublent jusqu'à cette limite ; avec un budget
+    // de temps, chaque lot est aussi borné par le temps restant à la cadence mesurée.
+    int max_batch_iterations = 1000;
+};
+
+enum class TrainingStopReason {
+    ITERATION_BUDGET,
+    TIME_BUDGET,
+    EXPLOITABILITY_TARGET
+};
+
+std::string stop_reason_to_string(TrainingStopReason reason);
+
+// État de l'entraînement, transmis au callback de progression après chaque lot.
+struct TrainingProgress {
+    int iterations = 0;          // Depuis le début du run
+    double elapsed_seconds = 0.0;
+    double iterations_per_second = 0.0;
+    bool has_evaluation = false; // Vrai si exploitability_mbb est renseignée
+    double exploitability_mbb = 0.0;
+    int evaluations = 0;
+    double evaluation_seconds = 0.0; // Temps cumulé passé en évaluation
+    int checkpoints = 0;
+};
+
+struct TrainingReport {
+    TrainingStopReason stop_reason = TrainingStopReason::ITERATION_BUDGET;
+    TrainingProgress final_progress;
+};
+
+// Pilote d'entraînement : enchaîne des lots d'itérations CFR jusqu'à épuisement
+// d'un budget (temps, itérations) ou jusqu'à une exploitabilité cible, en
+// intercalant évaluations, checkpoints et journalisation de la progression.
+class TrainingScheduler {
+public:
+    using ProgressCallback = std::function<void(const TrainingProgress&)>;
+
+    TrainingScheduler(CFREngine& engine,
+                      const ActionAbstraction& action_abstraction,
+                      const TrainingSchedulerConfig& config);
+
+    void set_progress_callback(ProgressCallback callback) { progress_callback_ = std::move(callback); }
+
+    // Lance l'entraînement. Lève std::invalid_argument si aucun critère d'arrêt n'est actif.
+    TrainingReport run(const GameState& initial_state);
+
+private:
+    bool write_checkpoint(TrainingProgress& progress);
+
+    CFREngine& engine_;
+    BestResponse best_response_;
+    TrainingSchedulerConfig config_;
+    ProgressCallback progress_callback_;
+    bool has_full_checkpoint_ = false;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_TRAINING_SCHEDULER_H
@@ -0,0 +1,63 @@
+#ifndef GTO_TREE_ESTIMATOR_H
+#define GTO_TREE_ESTIMATOR_H
+
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include "gto/information_set.h" // Pour StoragePrecision
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace gto_solver {
+
+struct TreeEstimatorConfig {
+    // Threads de parcours (0 : hardware_concurrency).
+    int threads = 0;
+    // Nombre maximal de nœuds publics parcourus (0 : illimité). Au-delà, le parcours
+    // s'arrête et l'estimation n'est qu'un minorant (TreeEstimate::truncated).
+    long long max_public_nodes = 0;
+    // Compte aussi les états publics distincts (GameState::public_state_hash) : taille de
+    // l'arbre avec TranspositionRule::PUBLIC_STATE. Un hachage est gardé par nœud de décision.
+    bool count_transpositions = false;
+};
+
+// Statistiques d'une street de l'arbre de mises.
+struct StreetTreeStats {
+    long long decision_nodes = 0; // Nœuds publics où un joueur agit (cartes exclues)
+    long long distinct_public_states = 0; // Si count_transpositions : nœuds après transpositions
+    long long action_slots = 0;   // Somme des actions légales de ces nœuds
+    // Projection sans abstraction de cartes : chaque nœud public est un infoset par
+    // board possible et par main privée du joueur qui agit.
+    double infosets = 0.0;
+    double infoset_action_slots = 0.0; // Regrets (et sommes de stratégie) à stocker
+    double key_heap_bytes = 0.0;       // Clés d'infoset trop longues pour la SSO
+
+    StreetTreeStats& operator+=(const StreetTreeStats& other);
+};
+
+// Estimation de la taille de l'arbre d'une abstraction, avant toute résolution.
+struct TreeEstimate {
+    std::array<StreetTreeStats, 4> streets; // PREFLOP à RIVER
+    long long terminal_nodes = 0;
+    long long chance_nodes = 0;
+    bool truncated = false; // max_public_nodes atteint : minorants
+    double seconds = 0.0;
+
+    StreetTreeStats total() const;
+    // Mémoire projetée de la table d'infosets (stockage, clés et nœuds de la table de hachage).
+    double projected_bytes(const StoragePrecision& precision) const;
+    // Rapport multi-lignes : nœuds et slots par street, puis mémoire pour chaque précision.
+    std::string report() const;
+};
+
+// Octets fixes par infoset dans InformationSetMap (nœud de hachage, clé, InformationSet, bucket).
+size_t infoset_overhead_bytes();
+
+// Parcourt l'arbre de mises de root (sans cartes : les cartes de board sont quelconques,
+// les actions n'en dépendent pas), en parallèle sur les sous-arbres.
+TreeEstimate estimate_tree_size(const GameState& root, const ActionAbstraction& action_abstraction,
+                                const TreeEstimatorConfig& config = {});
+
+} // namespace gto_solver
+
+#endif // GTO_TREE_ESTIMATOR_H
@@ -2,10 +2,12 @@
 #include "gto/game_state.h" // Nécessaire pour accéder à l'état du jeu
 #include "spdlog/spdlog.h"
 #include "gto/game_utils.hpp" // <-- AJOUT pour street_to_string
+#include "core/ini_file.hpp"
 #include <algorithm> // Pour std::min/max
 #include <cmath>     // Pour std::round
-#include <set>       // Pour éviter doublons dans les tailles de raise
 #include <stdexcept> // Inclus via header mais bonne pratique de l'inclure si utilisé implicitement
+#include <charconv>
+#include <optional>
 
 namespace gto_solver {
 
@@ -14,6 +16,34 @@ namespace gto_solver {
 // TODO: Rendre cette valeur configurable ou la récupérer depuis GameState/Config.
 // static constexpr int BB_SIZE_FOR_MIN_RAISE = 2; // Remplacé par state.get_big_blind_size()
 
+namespace {
+
+// Configuration à un seul niveau de relance (les mêmes tailles à chaque relance).
+ActionAbstractionConfig single_level_config(
+    bool allow_fold,
+    bool allow_check_call,
+    const ActionAbstraction::StreetFractionsMap& fractions_by_street,
+    const ActionAbstraction::StreetBBSizesMap& bb_sizes_by_street,
+    const ActionAbstraction::StreetExactBetsMap& exact_bets_by_street,
+    bool allow_all_in)
+{
+    ActionAbstractionConfig config;
+    config.allow_fold = allow_fold;
+    config.allow_check_call = allow_check_call;
+    config.allow_all_in = allow_all_in;
+    auto first_level = [&config](Street street) -> RaiseSizing& {
+        std::vector<RaiseSizing>& levels = config.streets[street].raise_levels;
+        if (levels.empty()) levels.emplace_back();
+        return levels.front();
+    };
+    for (const auto& [street, fractions] : fractions_by_street) first_level(street).pot_fractions = fractions;
+    for (const auto& [street, bb_sizes] : bb_sizes_by_street) first_level(street).bb_sizes = bb_sizes;
+    for (const auto& [street, exact_bets] : exact_bets_by_street) first_level(street).exact_bets = exact_bets;
+    return config;
+}
+
+} // namespace
+
 ActionAbstraction::ActionAbstraction(
     bool allow_fold,
     bool allow_check_call,
@@ -21,384 +51,247 @@ ActionAbstraction::ActionAbstraction(
     const StreetBBSizesMap& bb_sizes_by_street,
     const StreetExactBetsMap& exact_bets_by_street,
     bool allow_all_in)
-    : allow_fold_(allow_fold),
-      allow_check_call_(allow_check_call),
-      fractions_by_street_(fractions_by_street),
-      bb_sizes_by_street_(bb_sizes_by_street),
-      exact_bets_by_street_(exact_bets_by_street),
-      allow_all_in_(allow_all_in)
+    : ActionAbstraction(single_level_config(allow_fold, allow_check_call, fractions_by_street,
+                                            bb_sizes_by_street, exact_bets_by_street, allow_all_in))
 {
-    // Validation pour fractions_by_street_
-    for(const auto& pair : fractions_by_street_) {
-        const Street street = pair.first;
-        const std::set<double>& fractions = pair.second;
-        for(double frac : fractions) {
-            if (frac <= 0.0) {
-                 spdlog::warn("ActionAbstraction: Pour street {}, raise fraction {} <= 0 sera ignorée.", 
-                              street_to_string(street), // Assumer street_to_string existe
-                              frac);
-            }
-        }
-    }
-    // Validation pour bb_sizes_by_street_
-    for(const auto& pair : bb_sizes_by_street_) {
-        const Street street = pair.first;
-        const std::set<double>& bb_sizes = pair.second;
-        for(double bb_size_multiplier : bb_sizes) {
-            if (bb_size_multiplier <= 0.0) {
-                 spdlog::warn("ActionAbstraction: Pour street {}, multiplicateur BB {} <= 0 sera ignoré.", 
-                              street_to_string(street), bb_size_multiplier);
+}
+
+ActionAbstraction::ActionAbstraction(const ActionAbstractionConfig& config)
+    : allow_fold_(config.allow_fold),
+      allow_check_call_(config.allow_check_call),
+      allow_all_in_(config.allow_all_in)
+{
+    // Compilation en tableaux plats par street et par niveau (les std::set sont déjà triés)
+    bool any_raise_option = allow_all_in_;
+    size_t max_raises = 0;
+    for (const auto& [street, street_config] : config.streets) {
+        const size_t index = static_cast<size_t>(street);
+        if (index >= NUM_BETTING_STREETS) continue;
+        StreetRules& rules = rules_by_street_[index];
+        rules.max_raises = street_config.max_raises;
+        for (size_t level = 0; level < street_config.raise_levels.size(); ++level) {
+            const RaiseSizing& sizes = street_config.raise_levels[level];
+            StreetSizing sizing;
+            for (double frac : sizes.pot_fractions) {
+                if (frac > 0.0) sizing.pot_fractions.push_back(frac);
+                else spdlog::warn("ActionAbstraction: Pour street {} (niveau {}), raise fraction {} <= 0 sera ignorée.",
+                                  street_to_string(street), level, frac);
             }
-        }
-    }
-    for (const auto& pair : bb_sizes_by_street_) {
-        for (double bb_mult : pair.second) {
-            if (bb_mult <= 0) {
-                spdlog::warn("ActionAbstraction: BB multiplier must be positive: {}", bb_mult);
-                // On pourrait lancer une exception ici si on veut être plus strict
+            for (double bb_mult : sizes.bb_sizes) {
+                if (bb_mult > 0.0) sizing.bb_multipliers.push_back(bb_mult);
+                else spdlog::warn("ActionAbstraction: Pour street {} (niveau {}), multiplicateur BB {} <= 0 sera ignoré.",
+                                  street_to_string(street), level, bb_mult);
             }
-        }
-    }
-    for (const auto& pair : exact_bets_by_street_) {
-        for (int exact_bet : pair.second) {
-            if (exact_bet <= 0) {
-                spdlog::warn("ActionAbstraction: Exact bet amount must be positive: {}", exact_bet);
-                // On pourrait lancer une exception ici si on veut être plus strict
+            for (int exact : sizes.exact_bets) {
+                if (exact > 0) sizing.exact_bets.push_back(exact);
+                else spdlog::warn("ActionAbstraction: Exact bet amount must be positive: {}", exact);
             }
+            const size_t count = sizing.pot_fractions.size() + sizing.bb_multipliers.size() + sizing.exact_bets.size();
+            max_raises = std::max(max_raises, count);
+            any_raise_option |= count > 0 && rules.max_raises != 0;
+            rules.levels.push_back(std::move(sizing));
         }
     }
 
-    // Vérifier si TOUTES les streets ont des fractions vides ET que all-in est interdit
-    bool any_raise_option = allow_all_in_;
-    if (!any_raise_option) {
-        for(const auto& pair : fractions_by_street_) {
-            if (!pair.second.empty()) {
-                any_raise_option = true;
-                break;
-            }
-        }
-    }
-    if (!any_raise_option) {
-        for(const auto& pair : bb_sizes_by_street_) {
-            if (!pair.second.empty()) { any_raise_option = true; break; }
-        }
-    }
+    // Capacité : fold + call + toutes les tailles du niveau le plus fourni + all-in
+    max_actions_ = 2 + max_raises + 1;
     if (!any_raise_option) {
          spdlog::warn("ActionAbstraction: Aucune taille de relance spécifiée (ni fractions, ni tailles BB, ni all-in).");
     }
 }
 
-std::vector<Action> ActionAbstraction::get_abstract_actions(const GameState& state) const {
-    std::vector<Action> actions;
-    int current_player = state.get_current_player();
-
-    // Si la partie est terminée ou si le joueur n'est pas valide
-    if (current_player < 0 || current_player >= state.get_num_players()) {
-        spdlog::trace("ActionAbstraction::get_abstract_actions: Pas d'actions car joueur courant invalide ({}) ou partie terminée.", current_player);
-        return actions;
-    }
-
-    // Si le joueur est foldé ou n'a plus de stack (et pas de mise devant lui ?) -> il ne peut rien faire
-    // Note: Un joueur all-in ne devrait pas être interrogé pour une action. GameState gère ça ?
-     if (state.is_player_folded(current_player)) {
-         spdlog::trace("ActionAbstraction::get_abstract_actions: Pas d'actions pour P{} car déjà foldé.", current_player);
-         return actions;
-     }
-     // Attention: un joueur avec stack 0 mais une mise devant lui DOIT pouvoir agir si relancé.
-     // La logique dans les helpers devrait gérer ça (ex: peut seulement call 0 ou fold).
-
-
-    // 1. Action FOLD (si autorisée)
-    add_fold_action(actions, state);
+namespace {
 
-    // 2. Action CHECK/CALL (si autorisée)
-    add_check_call_action(actions, state);
-
-    // 3. Actions RAISE (si autorisées et possibles)
-    add_raise_actions(actions, state);
-
-    // Validation finale : au moins une action devrait être possible si le joueur n'est pas all-in ou foldé
-    // (au pire, check ou fold)
-    if (actions.empty() && state.get_player_stack(current_player) > 0) {
-         spdlog::warn("ActionAbstraction::get_abstract_actions: Aucune action générée pour P{} actif avec stack > 0. State:\n{}", current_player, state.toString());
-         // On pourrait forcer un check/fold ici comme fallback ?
-         // Par sécurité, ajoutons au moins un check/call si possible
-         if (allow_check_call_) {
-             add_check_call_action(actions, state); // Réessayer au cas où
-         }
-         if(actions.empty() && allow_fold_) {
-             int max_bet = 0; for (int b : state.get_current_bets()) max_bet = std::max(max_bet, b);
-             if(state.get_current_bets()[current_player] < max_bet) { // Peut folder
-                add_fold_action(actions, state);
-             }
-         }
-         if (actions.empty()) {
-             spdlog::error("ActionAbstraction::get_abstract_actions: Toujours aucune action pour P{} actif! Forcing FOLD.", current_player);
-             actions.push_back({current_player, ActionType::FOLD, 0}); // Fallback ultime
-         }
+// Street d'une section "preflop", "flop", "turn" ou "river".
+std::optional<Street> street_from_name(const std::string& name) {
+    static const std::pair<const char*, Street> STREETS[] = {
+        {"preflop", Street::PREFLOP}, {"flop", Street::FLOP}, {"turn", Street::TURN}, {"river", Street::RIVER}};
+    for (const auto& [street_name, street] : STREETS) {
+        if (name == street_name) return street;
     }
-
-
-    spdlog::trace("ActionAbstraction::get_abstract_actions: Actions générées pour P{}: {}", current_player, actions.size());
-    return actions;
+    return std::nullopt;
 }
 
-// --- Méthodes Helper Privées ---
-
-void ActionAbstraction::add_fold_action(std::vector<Action>& actions, const GameState& state) const {
-    if (!allow_fold_) return;
-
-    int current_player = state.get_current_player();
-    int player_bet = state.get_current_bets().at(current_player); // Utiliser .at() pour bounds checking
-    int max_bet = 0;
-    for (int bet : state.get_current_bets()) {
-        max_bet = std::max(max_bet, bet);
-    }
-
-    // On ne peut folder que s'il y a une mise à suivre (max_bet > player_bet)
-    // Si max_bet == player_bet, l'action légale est CHECK (géré par add_check_call_action)
-    if (player_bet < max_bet) {
-        actions.push_back({current_player, ActionType::FOLD, 0}); // Montant 0 pour FOLD
-        spdlog::trace("ActionAbstraction: FOLD ajouté pour P{}", current_player);
-    }
+RaiseSizing read_raise_sizing(const IniFile& ini, const std::string& section) {
+    RaiseSizing sizing;
+    for (double frac : ini.get_double_list(section, "pot_fractions")) sizing.pot_fractions.insert(frac);
+    for (double bb_mult : ini.get_double_list(section, "bb_sizes")) sizing.bb_sizes.insert(bb_mult);
+    for (int exact : ini.get_int_list(section, "exact_bets")) sizing.exact_bets.insert(exact);
+    return sizing;
 }
 
-void ActionAbstraction::add_check_call_action(std::vector<Action>& actions, const GameState& state) const {
-    if (!allow_check_call_) return;
+} // namespace
 
-    int current_player = state.get_current_player();
-    int player_stack = state.get_player_stack(current_player);
-    int player_bet = state.get_current_bets().at(current_player);
-    int max_bet = 0;
-    for (int bet : state.get_current_bets()) {
-        max_bet = std::max(max_bet, bet);
+ActionAbstractionConfig ActionAbstractionConfig::from_ini(const IniFile& ini) {
+    ActionAbstractionConfig config;
+    if (ini.has_section("abstraction")) {
+        ini.require_known_keys("abstraction", {"allow_fold", "allow_check_call", "allow_all_in"});
+        config.allow_fold = ini.get_bool("abstraction", "allow_fold", true);
+        config.allow_check_call = ini.get_bool("abstraction", "allow_check_call", true);
+        config.allow_all_in = ini.get_bool("abstraction", "allow_all_in", true);
     }
-    int amount_to_call = max_bet - player_bet;
 
-    // Vérifier si le joueur PEUT payer le call (même si c'est all-in)
-    // Note: amount_to_call peut être 0 (check)
-    if (amount_to_call < 0) {
-        // Ne devrait jamais arriver si la logique de GameState est correcte
-        spdlog::error("ActionAbstraction::add_check_call_action: amount_to_call négatif ({}) pour P{}. State:\n{}", amount_to_call, current_player, state.toString());
-        amount_to_call = 0; // Sécurité
+    // Sections de niveaux par street : "<street>" (niveau 0) et "<street>.raise<k>"
+    std::map<Street, std::map<int, std::string>> level_sections;
+    for (const std::string& section : ini.sections()) {
+        const size_t dot = section.find('.');
+        const std::optional<Street> street = street_from_name(section.substr(0, dot));
+        if (!street) continue; // Section d'un autre composant
+        if (dot == std::string::npos) {
+            ini.require_known_keys(section, {"pot_fractions", "bb_sizes", "exact_bets", "max_raises"});
+            level_sections[*street][0] = section;
+            continue;
+        }
+        const std::string suffix = section.substr(dot + 1);
+        int level = 0;
+        const char* digits = suffix.data() + std::min<size_t>(5, suffix.size());
+        const auto [ptr, ec] = std::from_chars(digits, suffix.data() + suffix.size(), level);
+        if (suffix.rfind("raise", 0) != 0 || ec != std::errc() || ptr != suffix.data() + suffix.size() || level < 1) {
+            throw std::invalid_argument("ActionAbstraction: section inconnue [" + section + "] (attendu [" +
+                                        section.substr(0, dot) + ".raise<k>], k >= 1)");
+        }
+        ini.require_known_keys(section, {"pot_fractions", "bb_sizes", "exact_bets"});
+        level_sections[*street][level] = section;
     }
 
-    // L'action est possible même si stack == 0, si amount_to_call == 0 (check)
-    // Si amount_to_call > 0, il faut avoir du stack pour call (même si c'est pour call all-in)
-    if (amount_to_call == 0 || player_stack > 0) {
-        // Montant réellement ajouté au pot par cette action
-        int call_amount_added = std::min(player_stack, amount_to_call);
-        // Montant total misé par le joueur APRES cette action
-        int total_bet_after_action = player_bet + call_amount_added;
-
-        actions.push_back({current_player, ActionType::CALL, total_bet_after_action});
-
-        if (amount_to_call == 0) {
-            spdlog::trace("ActionAbstraction: CHECK (Call 0 -> total bet {}) ajouté pour P{}", total_bet_after_action, current_player);
-        } else {
-             if (call_amount_added == player_stack && call_amount_added < amount_to_call) {
-                 spdlog::trace("ActionAbstraction: CALL All-in {} (total bet {}) ajouté pour P{}", call_amount_added, total_bet_after_action, current_player);
-             } else {
-                 spdlog::trace("ActionAbstraction: CALL {} (total bet {}) ajouté pour P{}", call_amount_added, total_bet_after_action, current_player);
-             }
+    for (const auto& [street, sections] : level_sections) {
+        StreetAbstraction& street_config = config.streets[street];
+        const int last_level = sections.rbegin()->first;
+        for (int level = 0; level <= last_level; ++level) {
+            auto it = sections.find(level);
+            if (it != sections.end()) {
+                street_config.raise_levels.push_back(read_raise_sizing(ini, it->second));
+            } else if (level > 0) {
+                street_config.raise_levels.push_back(street_config.raise_levels.back()); // Reprend le niveau précédent
+            } else {
+                street_config.raise_levels.emplace_back(); // Pas de section de base : all-in seul
+            }
+        }
+        if (sections.count(0)) {
+            street_config.max_raises = ini.get_int(sections.at(0), "max_raises", -1);
+            if (street_config.max_raises < -1) {
+                throw std::invalid_argument("[" + sections.at(0) + "] max_raises doit être >= -1");
+            }
         }
-    } else {
-         spdlog::trace("ActionAbstraction: Cannot CHECK/CALL for P{} (stack={}, amount_to_call={})", current_player, player_stack, amount_to_call);
     }
+    return config;
 }
 
-void ActionAbstraction::add_raise_actions(std::vector<Action>& actions, const GameState& state) const {
-    int current_player = state.get_current_player();
-    int player_stack = state.get_player_stack(current_player);
-
-    // On ne peut pas relancer si on n'a pas de stack
-    if (player_stack <= 0) {
-        return;
-    }
+ActionAbstraction ActionAbstraction::from_ini(const IniFile& ini) {
+    return ActionAbstraction(ActionAbstractionConfig::from_ini(ini));
+}
 
-    int player_bet = state.get_current_bets().at(current_player);
-    int pot_size = state.get_pot_size(); // Pot *avant* l'action du joueur courant
-    int last_raise_size = state.get_last_raise_size(); // Taille de l'incrément de la *dernière* relance
-    int max_bet = 0; // Mise la plus haute sur la table actuellement
-    for (int bet : state.get_current_bets()) {
-        max_bet = std::max(max_bet, bet);
-    }
-    int amount_to_call = max_bet - player_bet;
+ActionAbstraction ActionAbstraction::load(const std::string& filename) {
+    return from_ini(IniFile::load(filename));
+}
 
-    // Stack effectif pour la relance = ce qui reste APRES avoir égalisé la mise max
-    int effective_stack_for_raise = player_stack - amount_to_call;
-    // On ne peut relancer que si on a quelque chose à ajouter APRÈS avoir call
-    if (effective_stack_for_raise <= 0) {
-         spdlog::trace("ActionAbstraction: Cannot RAISE for P{} (stack={}, amount_to_call={}), no effective stack.", current_player, player_stack, amount_to_call);
-        return;
-    }
+std::vector<Action> ActionAbstraction::get_abstract_actions(const GameState& state) const {
+    std::vector<Action> actions;
+    get_abstract_actions(state, actions);
+    return actions;
+}
 
-    // Pot size *après* que le joueur courant ait call (base pour les sizings pot%)
-    // Le pot contient déjà les mises précédentes. Il faut ajouter le call du joueur courant.
-    int pot_if_player_calls = pot_size + amount_to_call;
+void ActionAbstraction::get_abstract_actions(const GameState& state, std::vector<Action>& actions) const {
+    actions.resize(max_actions_);
+    actions.resize(get_abstract_actions(state, std::span<Action>(actions)));
+}
 
-    // Calcul du min raise (selon les règles du poker)
-    // L'incrément minimum est la taille de la dernière relance, mais au moins 1 BB.
-    int current_bb_size = state.get_big_blind_size();
-    if (current_bb_size <= 0) { // Sécurité si la BB n'est pas définie ou est invalide
-        spdlog::error("ActionAbstraction::add_raise_actions: Big Blind size est <= 0 ({}) depuis GameState. Utilisation fallback à 1.", current_bb_size);
-        current_bb_size = 1; // Fallback très conservateur
+size_t ActionAbstraction::get_abstract_actions(const GameState& state, std::span<Action> out) const {
+    if (out.size() < max_actions_) {
+        throw std::invalid_argument("ActionAbstraction::get_abstract_actions: tampon < max_actions()");
     }
-    int min_raise_increment = std::max(last_raise_size, current_bb_size);
-
-    // Le montant *total* de la mise minimale après relance
-    int min_raise_total_bet = max_bet + min_raise_increment;
+    const int current_player = state.get_current_player();
 
-    // Calcul du max raise (All-in)
-    // Le montant total de la mise après all-in
-    int max_raise_total_bet = player_bet + player_stack; // Mise courante + tout le stack restant
-
-    // --- Déterminer si c'est une opportunité d'"ouvrir" le pot ---
-    bool is_open_opportunity = false;
-    if (state.get_current_street() == Street::PREFLOP) {
-        // Preflop, c'est une "open opportunity" si la mise max actuelle est juste la BB
-        // ET que la "dernière relance" était la BB elle-même (ou moins, e.g. SB limp)
-        // Cela couvre le cas UTG qui ouvre, ou SB qui open-raise par-dessus BB.
-        if (max_bet == current_bb_size && last_raise_size <= current_bb_size) {
-            is_open_opportunity = true;
-        }
-    } else { // Postflop
-        if (max_bet == 0) {
-            is_open_opportunity = true;
-        }
-    }
-    if (is_open_opportunity) {
-        spdlog::trace("ActionAbstraction: Situation d'ouverture détectée pour P{}", current_player);
+    // Si la partie est terminée, si le joueur n'est pas valide ou s'il est foldé : aucune action
+    if (current_player < 0 || current_player >= state.get_num_players() || state.is_player_folded(current_player)) {
+        SPDLOG_TRACE("ActionAbstraction::get_abstract_actions: Pas d'actions pour P{}.", current_player);
+        return 0;
     }
 
-    // --- Cas Spécial : Min Raise force All-in ---
-    // Si la mise minimale requise est déjà égale ou supérieure à un all-in,
-    // la seule "relance" possible est all-in.
-    if (min_raise_total_bet >= max_raise_total_bet) {
-        if (allow_all_in_) {
-            // S'assurer que cet all-in est bien *supérieur* à un simple call.
-            // (On ne propose pas "Raise All-in" si ça revient juste à caller)
-            if (max_raise_total_bet > max_bet) {
-                 actions.push_back({current_player, ActionType::RAISE, max_raise_total_bet});
-                 spdlog::trace("ActionAbstraction: RAISE (All-in {}) ajouté pour P{} (seule option car min_raise >= all_in)", max_raise_total_bet, current_player);
-            } else {
-                 spdlog::trace("ActionAbstraction: All-in ({}) pour P{} est <= max_bet ({}), pas ajouté comme RAISE.", max_raise_total_bet, current_player, max_bet);
-            }
-        } else {
-            spdlog::trace("ActionAbstraction: Min raise ({}) >= All-in ({}) mais All-in non autorisé pour P{}", min_raise_total_bet, max_raise_total_bet, current_player);
-        }
-        return; // Aucune autre taille de relance n'est possible
+    // Une seule lecture des mises
+    const std::vector<int>& bets = state.get_current_bets();
+    int max_bet = 0;
+    for (int bet : bets) max_bet = std::max(max_bet, bet);
+    const int player_bet = bets[current_player];
+    const int player_stack = state.get_player_stack(current_player);
+    const int amount_to_call = std::max(0, max_bet - player_bet);
+    size_t count = 0;
+
+    // 1. FOLD : seulement s'il y a une mise à suivre (sinon l'action légale est CHECK)
+    if (allow_fold_ && amount_to_call > 0) {
+        out[count++] = {current_player, ActionType::FOLD, 0}; // Montant 0 pour FOLD
     }
 
-    std::set<int> raise_total_bets;
-    Street current_street = state.get_current_street();
-
-    // 1. Ajouter les relances basées sur les fractions du pot
-    const auto it_frac = fractions_by_street_.find(current_street);
-    if (it_frac != fractions_by_street_.end()) {
-        const std::set<double>& fracs = it_frac->second;
-        if (!fracs.empty()) {
-            spdlog::trace("ActionAbstraction: Calcul raises par fraction de pot (pot_if_player_calls={}) pour street {}", pot_if_player_calls, street_to_string(current_street));
-            for (double fraction : fracs) {
-                if (fraction <= 0) continue;
-                int raise_increment_from_pot = static_cast<int>(std::round(fraction * pot_if_player_calls));
-                raise_increment_from_pot = std::max(0, raise_increment_from_pot);
-                int candidate_total_bet = max_bet + raise_increment_from_pot;
-                candidate_total_bet = std::max(min_raise_total_bet, candidate_total_bet);
-                candidate_total_bet = std::min(max_raise_total_bet, candidate_total_bet);
-                if (candidate_total_bet > max_bet) {
-                     raise_total_bets.insert(candidate_total_bet);
-                     spdlog::trace("  -> Frac {:.2f}: inc={}, clamped_total_bet={}. Ajouté.", fraction, raise_increment_from_pot, candidate_total_bet);
-                }
-            }
-        }
+    // 2. CHECK/CALL : possible avec un stack nul si rien n'est à payer (call all-in sinon)
+    if (allow_check_call_ && (amount_to_call == 0 || player_stack > 0)) {
+        out[count++] = {current_player, ActionType::CALL, player_bet + std::min(player_stack, amount_to_call)};
     }
 
-    // 2. Relances basées sur des multiples de BB
-    auto street_bb_sizes_it = bb_sizes_by_street_.find(current_street);
-    if (street_bb_sizes_it != bb_sizes_by_street_.end()) {
-        const auto& bb_multipliers = street_bb_sizes_it->second;
-        for (double bb_mult : bb_multipliers) {
-            if (bb_mult <= 0) continue;
-            int candidate_total_bet;
-            if (is_open_opportunity) {
-                // Pour une ouverture, le multiplicateur de BB définit la taille totale de la mise
-                candidate_total_bet = static_cast<int>(bb_mult * current_bb_size);
-            } else {
-                // Pour une sur-relance, le multiplicateur de BB définit la taille de l'incrément de relance
-                int raise_increment_bb = static_cast<int>(bb_mult * current_bb_size);
-                candidate_total_bet = max_bet + raise_increment_bb;
-            }
-
-            candidate_total_bet = std::max(candidate_total_bet, min_raise_total_bet);
-            candidate_total_bet = std::min(candidate_total_bet, max_raise_total_bet);
-
-            if (candidate_total_bet > max_bet) {
-                raise_total_bets.insert(candidate_total_bet);
-                spdlog::trace("  P{}: BB mult {} -> total_bet {} (open? {}, inc {})", current_player, bb_mult, candidate_total_bet, is_open_opportunity, candidate_total_bet - max_bet);
-            }
+    // 3. RAISE : candidats écrits à la suite, puis triés et dédoublonnés sur place
+    const size_t first_raise = count;
+    const size_t street_index = static_cast<size_t>(state.get_current_street());
+    const int effective_stack_for_raise = player_stack - amount_to_call; // Ce qui reste après avoir égalisé
+    // Plafond de relances de la street (l'all-in compte comme une relance)
+    const StreetRules* rules = street_index < NUM_BETTING_STREETS ? &rules_by_street_[street_index] : nullptr;
+    const bool raise_allowed = rules && (rules->max_raises < 0 || state.get_street_raise_count() < rules->max_raises);
+    if (player_stack > 0 && effective_stack_for_raise > 0 && raise_allowed) {
+        int bb_size = state.get_big_blind_size();
+        if (bb_size <= 0) { // Sécurité si la BB n'est pas définie ou est invalide
+            spdlog::error("ActionAbstraction::get_abstract_actions: Big Blind size est <= 0 ({}). Utilisation fallback à 1.", bb_size);
+            bb_size = 1;
         }
-    }
-    
-    // 3. Mises exactes (NOUVEAU)
-    auto street_exact_bets_it = exact_bets_by_street_.find(current_street);
-    if (street_exact_bets_it != exact_bets_by_street_.end()) {
-        const auto& exact_amounts = street_exact_bets_it->second;
-        for (int exact_val : exact_amounts) {
-            if (exact_val <= 0) {
-                spdlog::trace("  P{}: Exact bet value {} is <=0. Skipping.", current_player, exact_val);
-                continue;
+        // Incrément minimum : la dernière relance, au moins 1 BB
+        const int min_raise_increment = std::max(state.get_last_raise_size(), bb_size);
+        const int min_raise_total_bet = max_bet + min_raise_increment;
+        const int max_raise_total_bet = player_bet + player_stack; // All-in
+        // Base des fractions : pot si le joueur courant paie
+        const int pot_if_player_calls = state.get_pot_size() + amount_to_call;
+        // Ouverture : preflop si la mise max est la BB (limps compris), postflop si personne n'a misé
+        const bool is_open_opportunity = street_index == static_cast<size_t>(Street::PREFLOP)
+                                             ? (max_bet == bb_size && state.get_last_raise_size() <= bb_size)
+                                             : max_bet == 0;
+        auto clamp_total = [&](int total) { return std::min(max_raise_total_bet, std::max(min_raise_total_bet, total)); };
+
+        if (min_raise_total_bet >= max_raise_total_bet) {
+            // La relance minimale force l'all-in : seule relance possible
+            if (allow_all_in_ && max_raise_total_bet > max_bet) {
+                out[count++] = {current_player, ActionType::RAISE, max_raise_total_bet};
             }
-            int candidate_total_bet;
-            if (is_open_opportunity) {
-                // Pour une ouverture, le montant exact définit la taille totale de la mise
-                candidate_total_bet = exact_val;
-                 spdlog::trace("  P{}: Exact bet (open) specified: {}", current_player, exact_val);
-            } else {
-                // Pour une sur-relance, le montant exact définit la taille de l'incrément
-                candidate_total_bet = max_bet + exact_val;
-                spdlog::trace("  P{}: Exact bet (re-raise increment) specified: {} -> total {}", current_player, exact_val, candidate_total_bet);
+        } else {
+            // Niveau de relance : nombre de relances déjà faites, borné au dernier niveau configuré
+            static const StreetSizing ALL_IN_ONLY;
+            const size_t level = std::min<size_t>(static_cast<size_t>(state.get_street_raise_count()),
+                                                  rules->levels.empty() ? 0 : rules->levels.size() - 1);
+            const StreetSizing& sizing = rules->levels.empty() ? ALL_IN_ONLY : rules->levels[level];
+            for (double fraction : sizing.pot_fractions) {
+                const int increment = std::max(0, static_cast<int>(std::round(fraction * pot_if_player_calls)));
+                out[count++] = {current_player, ActionType::RAISE, clamp_total(max_bet + increment)};
             }
-
-            // Important: Clamper par min_raise_total_bet seulement si ce n'est pas une ouverture à 0
-            // Ou si le min_raise_total_bet est effectivement plus grand que notre mise exacte d'ouverture
-            if (!is_open_opportunity || candidate_total_bet < min_raise_total_bet) {
-                candidate_total_bet = std::max(candidate_total_bet, min_raise_total_bet);
-            }                    
-            candidate_total_bet = std::min(candidate_total_bet, max_raise_total_bet);
-
-            if (candidate_total_bet > max_bet) {
-                raise_total_bets.insert(candidate_total_bet);
-                spdlog::trace("  P{}: Exact bet value {} -> final total_bet {} (open? {})", current_player, exact_val, candidate_total_bet, is_open_opportunity);
-            } else {
-                spdlog::trace("  P{}: Exact bet value {} (open? {}) -> candidate {} not > max_bet {}. Clamped min_raise_total_bet was {}. Skipping.", 
-                              current_player, exact_val, is_open_opportunity, candidate_total_bet, max_bet, min_raise_total_bet);
+            for (double bb_mult : sizing.bb_multipliers) {
+                // Ouverture : taille totale de la mise ; sur-relance : taille de l'incrément
+                const int size = static_cast<int>(bb_mult * bb_size);
+                out[count++] = {current_player, ActionType::RAISE, clamp_total(is_open_opportunity ? size : max_bet + size)};
             }
+            for (int exact : sizing.exact_bets) {
+                // Même convention : total à l'ouverture, incrément en sur-relance
+                out[count++] = {current_player, ActionType::RAISE, clamp_total(is_open_opportunity ? exact : max_bet + exact)};
+            }
+            if (allow_all_in_) out[count++] = {current_player, ActionType::RAISE, max_raise_total_bet};
         }
     }
-
-    // 4. Ajouter l'action All-in (si autorisée)
-    if (allow_all_in_) {
-        if (max_raise_total_bet > max_bet) {
-             spdlog::trace("ActionAbstraction: Ajout de RAISE All-in ({}) pour P{}", max_raise_total_bet, current_player);
-             raise_total_bets.insert(max_raise_total_bet);
-        } else {
-             spdlog::trace("ActionAbstraction: All-in ({}) pour P{} est <= max_bet ({}), pas ajouté comme RAISE.", max_raise_total_bet, current_player, max_bet);
-        }
-    }
-
-    // --- Finalisation : Ajouter les montants uniques au vecteur d'actions ---
-    for (int final_total_bet : raise_total_bets) {
-        int raise_increment = final_total_bet - max_bet;
-        bool is_all_in_raise = (final_total_bet == max_raise_total_bet);
-        if (!is_all_in_raise && raise_increment < min_raise_increment) {
-             spdlog::warn("ActionAbstraction: Ignored raise amount {} for P{}: raise_increment {} < min_raise_increment {} (and not all-in)",
-                          final_total_bet, current_player, raise_increment, min_raise_increment);
-             continue;
-        }
-        actions.push_back({current_player, ActionType::RAISE, final_total_bet});
-        spdlog::trace("ActionAbstraction: RAISE ({}) ajouté pour P{}", final_total_bet, current_player);
+    // Tailles croissantes, sans doublon (min_raise_total_bet > max_bet : toute relance dépasse le call)
+    std::sort(out.begin() + first_raise, out.begin() + count,
+              [](const Action& a, const Action& b) { return a.amount < b.amount; });
+    count = std::unique(out.begin() + first_raise, out.begin() + count,
+                        [](const Action& a, const Action& b) { return a.amount == b.amount; }) - out.begin();
+
+    if (count == 0 && player_stack > 0) {
+        // Aucune action pour un joueur actif (abstraction sans fold ni call) : fold forcé
+        spdlog::error("ActionAbstraction::get_abstract_actions: Aucune action pour P{} actif! Forcing FOLD.", current_player);
+        out[count++] = {current_player, ActionType::FOLD, 0};
     }
+    SPDLOG_TRACE("ActionAbstraction::get_abstract_actions: Actions générées pour P{}: {}", current_player, count);
+    return count;
 }
 
-} // namespace gto_solver 
\ No newline at end of file
+} // namespace gto_solver
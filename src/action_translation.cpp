@@ -0,0 +1,103 @@
+#include "gto/action_translation.h"
+#include "gto/game_state.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace gto_solver {
+
+namespace {
+
+int max_current_bet(const GameState& state) {
+    int max_bet = 0;
+    for (int bet : state.get_current_bets()) max_bet = std::max(max_bet, bet);
+    return max_bet;
+}
+
+// Pot si le joueur courant paie (base des fractions de ActionAbstraction), au moins 1
+int pot_if_player_calls(const GameState& state, int max_bet) {
+    const int player = state.get_current_player();
+    const int player_bet = player >= 0 ? state.get_current_bets().at(player) : max_bet;
+    return std::max(1, state.get_pot_size() + max_bet - player_bet);
+}
+
+} // namespace
+
+double raise_pot_fraction(const GameState& state, int total_bet) {
+    const int max_bet = max_current_bet(state);
+    return static_cast<double>(total_bet - max_bet) / pot_if_player_calls(state, max_bet);
+}
+
+double pseudo_harmonic_probability(double a, double b, double x) {
+    if (b <= a) return 1.0;
+    if (x <= a) return 1.0;
+    if (x >= b) return 0.0;
+    return ((b - x) * (1.0 + a)) / ((b - a) * (1.0 + x));
+}
+
+// -----------------------------------------------------------------------------
+TranslationTable::TranslationTable(const GameState& state, const std::vector<Action>& legal_actions)
+    : max_bet_(max_current_bet(state)), pot_if_call_(pot_if_player_calls(state, max_bet_)) {
+    std::vector<int> raises;
+    for (size_t i = 0; i < legal_actions.size(); ++i) {
+        switch (legal_actions[i].type) {
+            case ActionType::FOLD: fold_index_ = static_cast<int>(i); break;
+            case ActionType::CALL: call_index_ = static_cast<int>(i); break;
+            case ActionType::RAISE: raises.push_back(static_cast<int>(i)); break;
+        }
+    }
+    std::sort(raises.begin(), raises.end(), [&](int a, int b) { return legal_actions[a].amount < legal_actions[b].amount; });
+    raise_indices_ = raises;
+    raise_fractions_.reserve(raises.size());
+    for (int i : raises) {
+        raise_fractions_.push_back(static_cast<double>(legal_actions[i].amount - max_bet_) / pot_if_call_);
+    }
+}
+
+TranslatedAction TranslationTable::translate(const Action& action) const {
+    switch (action.type) {
+        case ActionType::FOLD: return {fold_index_, fold_index_, 1.0};
+        case ActionType::CALL: return {call_index_, call_index_, 1.0};
+        case ActionType::RAISE: break;
+    }
+    return translate_raise_fraction(static_cast<double>(action.amount - max_bet_) / pot_if_call_);
+}
+
+TranslatedAction TranslationTable::translate_raise_fraction(double fraction) const {
+    if (raise_fractions_.empty()) return {};
+    // Première taille abstraite >= fraction
+    const auto it = std::lower_bound(raise_fractions_.begin(), raise_fractions_.end(), fraction);
+    if (it == raise_fractions_.begin()) return {raise_indices_.front(), raise_indices_.front(), 1.0};
+    if (it == raise_fractions_.end()) return {raise_indices_.back(), raise_indices_.back(), 1.0};
+    const size_t upper = it - raise_fractions_.begin();
+    if (*it == fraction) return {raise_indices_[upper], raise_indices_[upper], 1.0};
+    return {raise_indices_[upper - 1], raise_indices_[upper],
+            pseudo_harmonic_probability(raise_fractions_[upper - 1], raise_fractions_[upper], fraction)};
+}
+
+// -----------------------------------------------------------------------------
+ActionTranslator::ActionTranslator(const ActionAbstraction& action_abstraction, TranslationMode mode)
+    : action_abstraction_(action_abstraction), mode_(mode) {}
+
+TranslatedAction ActionTranslator::translate(const GameState& state, const Action& action) const {
+    const std::vector<Action> legal_actions = state.get_legal_abstract_actions(action_abstraction_);
+    return TranslationTable(state, legal_actions).translate(action);
+}
+
+Action ActionTranslator::map(const GameState& state, const Action& action, Rng& rng) const {
+    const std::vector<Action> legal_actions = state.get_legal_abstract_actions(action_abstraction_);
+    const TranslatedAction translated = TranslationTable(state, legal_actions).translate(action);
+    if (!translated.valid()) {
+        throw std::invalid_argument("ActionTranslator::map: aucune action abstraite de ce type");
+    }
+    return legal_actions[resolve(translated, rng)];
+}
+
+int ActionTranslator::resolve(const TranslatedAction& translated, Rng& rng) const {
+    if (translated.lower == translated.upper) return translated.lower;
+    if (mode_ == TranslationMode::DETERMINISTIC) {
+        return translated.lower_probability >= 0.5 ? translated.lower : translated.upper;
+    }
+    return rng.uniform_real() < translated.lower_probability ? translated.lower : translated.upper;
+}
+
+} // namespace gto_solver
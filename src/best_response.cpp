@@ -0,0 +1,282 @@
+#include "gto/best_response.h"
+#include "gto/information_set.h"
+#include "eval/hand_evaluator.hpp"
+#include "core/deck.hpp" // Pour deal_cards
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+namespace gto_solver {
+
+namespace {
+
+// Nombre de façons de choisir k cartes parmi n.
+double count_combinations(int n, int k) {
+    if (k < 0 || n < k) return 0.0;
+    double count = 1.0;
+    for (int i = 0; i < k; ++i) count = count * (n - i) / (i + 1);
+    return count;
+}
+
+Bitboard board_mask_of(const GameState& state) {
+    Bitboard mask = EMPTY_BOARD;
+    for (int i = 0; i < state.get_board_cards_dealt(); ++i) set_card(mask, state.get_board()[i]);
+    return mask;
+}
+
+// Tous les ensembles de k cartes de available (chacun une seule fois).
+void enumerate_card_sets(Bitboard available, int k, Bitboard current, std::vector<Bitboard>& out) {
+    if (k == 0) {
+        out.push_back(current);
+        return;
+    }
+    while (available) {
+        const Card card = pop_lsb(available);
+        Bitboard next = current;
+        set_card(next, card);
+        enumerate_card_sets(available, k - 1, next, out);
+    }
+}
+
+} // namespace
+
+BestResponse::BestResponse(const CFREngine& engine, const ActionAbstraction& action_abstraction)
+    : engine_(engine), action_abstraction_(action_abstraction) {}
+
+bool BestResponse::is_supported(const GameState& root_state) const {
+    return root_state.get_num_players() == 2 && engine_.get_config().transpositions == TranspositionRule::NONE;
+}
+
+ExploitabilityResult BestResponse::compute(const GameState& root_state,
+                                           int num_chance_samples,
+                                           int num_threads,
+                                           uint64_t seed) const {
+    ExploitabilityResult result;
+    if (!is_supported(root_state)) {
+        spdlog::error("BestResponse: partie non supportée ({} joueurs, transpositions {}).",
+                      root_state.get_num_players(),
+                      engine_.get_config().transpositions == TranspositionRule::NONE ? "non" : "oui");
+        result.supported = false;
+        return result;
+    }
+    if (num_chance_samples <= 0) return result;
+
+    const auto start = std::chrono::steady_clock::now();
+    if (num_threads <= 0) num_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    // Ranges uniformes, board déroulé par des nœuds de hasard explicites
+    GameState root = root_state;
+    root.clear_private_cards();
+    if (!root.is_chance_node()) root.set_explicit_chance_nodes(true);
+    const Bitboard root_board = board_mask_of(root);
+    const RangeVector root_reach = make_uniform_range(root_board);
+    const int free_cards = NUM_CARDS - count_set_bits(root_board);
+    // Chaque paire (main BR, main adverse) compatible avec le board de départ est équiprobable.
+    const double num_pairs = count_combinations(free_cards, 2) * count_combinations(free_cards - 2, 2);
+
+    BoardRanking root_ranking;
+    if (root.get_board_cards_dealt() == 5) root_ranking = rank_hole_combos(root.get_board());
+
+    std::vector<Action> history;
+    for (int br_player = 0; br_player < 2; ++br_player) {
+        TraversalContext ctx;
+        ctx.br_player = br_player;
+        ctx.chance_samples = num_chance_samples;
+        ctx.seed = seed;
+        ctx.threads = num_threads;
+        ctx.ranking = root.get_board_cards_dealt() == 5 ? &root_ranking : nullptr;
+        history.clear();
+        const RangeVector values = traverse(root, history, root_reach, ctx);
+        double sum = 0.0;
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (root_reach[h] > 0.0) sum += values[h];
+        }
+        result.best_response_values[br_player] = sum / num_pairs;
+    }
+
+    result.exploitability_chips = (result.best_response_values[0] + result.best_response_values[1]) / 2.0;
+    result.exploitability_mbb = result.exploitability_chips / root_state.get_big_blind_size() * 1000.0;
+    result.chance_samples = num_chance_samples;
+    result.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    spdlog::info("BestResponse: BR0={:.4f} BR1={:.4f} exploitabilité={:.2f} mbb/main ({} issues par nœud de hasard, {} threads, {:.2f}s)",
+                 result.best_response_values[0], result.best_response_values[1],
+                 result.exploitability_mbb, num_chance_samples, num_threads, result.elapsed_seconds);
+    return result;
+}
+
+RangeVector BestResponse::traverse(const GameState& state,
+                                   std::vector<Action>& action_history,
+                                   const RangeVector& opp_reach,
+                                   const TraversalContext& ctx) const {
+    if (state.is_chance_node()) {
+        return chance_values(state, action_history, opp_reach, ctx);
+    }
+    if (state.is_terminal()) {
+        return terminal_values(state, opp_reach, ctx);
+    }
+
+    const int acting_player = state.get_current_player();
+    const std::vector<Action> legal_actions = state.get_legal_abstract_actions(action_abstraction_);
+    if (legal_actions.empty()) {
+        spdlog::error("BestResponse: aucune action légale pour un nœud non terminal. State:\n{}", state.toString());
+        return RangeVector(NUM_HOLE_COMBOS, 0.0);
+    }
+
+    if (acting_player == ctx.br_player) {
+        // Nœud du joueur BR : meilleure action, main par main (valeurs déjà moyennées
+        // sur les cartes à venir).
+        RangeVector best(NUM_HOLE_COMBOS, -std::numeric_limits<double>::infinity());
+        for (const Action& action : legal_actions) {
+            GameState next_state = state;
+            next_state.apply_action(action);
+            action_history.push_back(action);
+            const RangeVector child = traverse(next_state, action_history, opp_reach, ctx);
+            action_history.pop_back();
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) best[h] = std::max(best[h], child[h]);
+        }
+        return best;
+    }
+
+    // Nœud adverse : la range adverse est répartie selon sa stratégie moyenne.
+    // La partie de la clé d'infoset commune à toutes les mains est calculée une seule fois.
+    const std::string public_key = InformationSet::generate_key(
+        acting_player, {}, state.get_board(), state.get_board_cards_dealt(),
+        state.get_current_street(), action_history);
+    const std::string key_prefix = "P" + std::to_string(acting_player) + ";";
+    const std::string key_suffix = public_key.substr(public_key.find('|'));
+
+    const auto& hole_strings = hole_combo_strings();
+    const size_t num_actions = legal_actions.size();
+    std::vector<RangeVector> child_reach(num_actions, RangeVector(NUM_HOLE_COMBOS, 0.0));
+    std::vector<double> strategy;
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (opp_reach[h] == 0.0) continue;
+        average_strategy(key_prefix + hole_strings[h] + key_suffix, num_actions, strategy);
+        for (size_t a = 0; a < num_actions; ++a) child_reach[a][h] = opp_reach[h] * strategy[a];
+    }
+
+    RangeVector values(NUM_HOLE_COMBOS, 0.0);
+    for (size_t a = 0; a < num_actions; ++a) {
+        GameState next_state = state;
+        next_state.apply_action(legal_actions[a]);
+        action_history.push_back(legal_actions[a]);
+        const RangeVector child = traverse(next_state, action_history, child_reach[a], ctx);
+        action_history.pop_back();
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += child[h];
+    }
+    return values;
+}
+
+RangeVector BestResponse::chance_values(const GameState& state,
+                                        std::vector<Action>& action_history,
+                                        const RangeVector& opp_reach,
+                                        const TraversalContext& ctx) const {
+    const Bitboard board = board_mask_of(state);
+    const Bitboard available = FULL_DECK & ~board;
+    const int free_cards = count_set_bits(available);
+    const int cards_to_deal = state.get_pending_board_cards();
+    const double num_outcomes = count_combinations(free_cards, cards_to_deal);
+
+    std::vector<Bitboard> outcomes;
+    if (num_outcomes <= ctx.chance_samples) {
+        enumerate_card_sets(available, cards_to_deal, EMPTY_BOARD, outcomes);
+    } else {
+        // Graine dérivée du board : mêmes issues pour toutes les lignes d'actions qui y
+        // mènent et pour les deux joueurs (les max du joueur BR comparent les mêmes tirages).
+        Rng rng(derive_seed(ctx.seed, board));
+        if (cards_to_deal == 1) {
+            std::vector<Card> cards(ctx.chance_samples);
+            deal_cards(board, ctx.chance_samples, rng, cards.data()); // Cartes distinctes
+            for (Card card : cards) outcomes.push_back(1ULL << card);
+        } else {
+            for (int i = 0; i < ctx.chance_samples; ++i) outcomes.push_back(deal_cards(board, cards_to_deal, rng));
+        }
+    }
+    // Pour une paire (main BR, main adverse), les C(free_cards - 4, k) issues évitant ses
+    // quatre cartes sont équiprobables ; un échantillon compte pour num_outcomes / |outcomes|.
+    const double weight = num_outcomes / outcomes.size() / count_combinations(free_cards - 4, cards_to_deal);
+
+    auto outcome_values = [&](Bitboard outcome, std::vector<Action>& history, int threads) {
+        GameState next_state = state;
+        for (Bitboard cards = outcome; cards;) next_state.deal_board_card(pop_lsb(cards));
+        RangeVector child_reach = opp_reach;
+        remove_blocked_combos(child_reach, outcome);
+        TraversalContext child_ctx = ctx;
+        child_ctx.threads = threads;
+        BoardRanking ranking;
+        if (next_state.get_board_cards_dealt() == 5) {
+            ranking = rank_hole_combos(next_state.get_board()); // Une fois pour tous les showdowns du board
+            child_ctx.ranking = &ranking;
+        }
+        RangeVector child = traverse(next_state, history, child_reach, child_ctx);
+        remove_blocked_combos(child, outcome); // Mains BR incompatibles avec l'issue
+        return child;
+    };
+
+    RangeVector values(NUM_HOLE_COMBOS, 0.0);
+    const int num_threads = std::min(ctx.threads, static_cast<int>(outcomes.size()));
+    if (num_threads > 1) {
+        // Issues réparties entre threads, sommées dans l'ordre : même résultat qu'en série
+        std::vector<RangeVector> results(outcomes.size());
+        std::atomic<size_t> next_outcome{0};
+        auto worker = [&]() {
+            std::vector<Action> history = action_history;
+            for (size_t i = next_outcome++; i < outcomes.size(); i = next_outcome++) {
+                results[i] = outcome_values(outcomes[i], history, 1);
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < num_threads; ++t) threads.emplace_back(worker);
+        worker();
+        for (auto& th : threads) th.join();
+        for (const RangeVector& child : results) {
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += child[h];
+        }
+    } else {
+        for (Bitboard outcome : outcomes) {
+            const RangeVector child = outcome_values(outcome, action_history, ctx.threads);
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += child[h];
+        }
+    }
+    for (double& v : values) v *= weight;
+    return values;
+}
+
+RangeVector BestResponse::terminal_values(const GameState& state,
+                                          const RangeVector& opp_reach,
+                                          const TraversalContext& ctx) const {
+    const int opponent = 1 - ctx.br_player;
+    RangeVector out;
+    if (state.is_player_folded(ctx.br_player)) {
+        fold_values(opp_reach, -static_cast<double>(state.get_player_contribution(ctx.br_player)), out);
+    } else if (state.is_player_folded(opponent)) {
+        fold_values(opp_reach, static_cast<double>(state.get_player_contribution(opponent)), out);
+    } else if (ctx.ranking == nullptr) {
+        spdlog::error("BestResponse: showdown sans board complet. State:\n{}", state.toString());
+        out.assign(NUM_HOLE_COMBOS, 0.0);
+    } else {
+        // Showdown : le board a été complété par les nœuds de hasard au-dessus.
+        const double stake = std::min(state.get_player_contribution(ctx.br_player),
+                                      state.get_player_contribution(opponent));
+        showdown_values(opp_reach, ctx.ranking->hand_ranks, ctx.ranking->sorted_combos, stake, out);
+    }
+    return out;
+}
+
+void BestResponse::average_strategy(const std::string& infoset_key, size_t num_actions, std::vector<double>& out) const {
+    out.assign(num_actions, 1.0 / num_actions);
+    const InformationSetMap& infosets = engine_.get_infoset_map();
+    auto it = infosets.find(infoset_key);
+    if (it == infosets.end() || it->second.num_actions() != num_actions) return;
+
+    double sum = 0.0;
+    for (size_t a = 0; a < num_actions; ++a) sum += it->second.get_strategy_sum(a);
+    if (sum <= 0.0) return;
+    for (size_t a = 0; a < num_actions; ++a) out[a] = it->second.get_strategy_sum(a) / sum;
+}
+
+} // namespace gto_solver
@@ -2,42 +2,173 @@
 #include "eval/hand_evaluator.hpp" // Assurer la définition complète pour l'utilisation
 #include "gto/information_set.h" // Déjà inclus via cfr_engine.h mais explicite
 #include "gto/game_utils.hpp"      // Pour street_to_string
+#include "core/deck.hpp"           // Pour deal_cards
 #include "spdlog/spdlog.h"
 #include <numeric> // Pour std::accumulate
 #include <stdexcept> // Pour std::runtime_error
 #include <fstream> // Pour std::ofstream
 #include <sstream> // Pour std::stringstream (pourrait être utile)
 #include <iomanip> // Pour std::setprecision
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <limits>
 
 namespace gto_solver {
 
-CFREngine::CFREngine(const ActionAbstraction& action_abstraction)
-    : action_abstraction_(action_abstraction) {}
+CFREngine::CFREngine(const ActionAbstraction& action_abstraction, const CFREngineConfig& config)
+    : action_abstraction_(action_abstraction), config_(config), rng_(config.seed) {
+    if (config_.cache_legal_actions) legal_action_cache_ = std::make_unique<LegalActionCache>(action_abstraction_);
+}
 
 void CFREngine::run_iterations(int num_iterations, GameState initial_state_template) {
     if (initial_state_template.get_num_players() <= 0) {
         spdlog::error("CFREngine: Nombre de joueurs invalide dans l'état initial.");
         return;
     }
+    if (config_.traversal_mode == TraversalMode::PUBLIC_CHANCE_SAMPLING && initial_state_template.get_num_players() != 2) {
+        spdlog::error("CFREngine: le mode PCS est limité au heads-up ({} joueurs).", initial_state_template.get_num_players());
+        return;
+    }
 
+    const auto batch_start = std::chrono::steady_clock::now();
     for (int i = 0; i < num_iterations; ++i) {
-        spdlog::info("CFR Iteration {}/{}", i + 1, num_iterations);
-        current_hand_action_history_.clear(); // Historique pour la clé d'infoset
+        SPDLOG_DEBUG("CFR Iteration {}/{}", i + 1, num_iterations);
+        const int iteration_num = iteration_count_++;
+
+        if (config_.traversal_mode == TraversalMode::PUBLIC_CHANCE_SAMPLING) {
+            TraversalContext ctx;
+            ctx.rng.seed_with(rng_());
+            ctx.scratch = &thread_scratch_arena();
+            ScratchArena::Frame iteration_frame(*ctx.scratch); // Arène rembobinée à chaque itération
+            if (config_.enable_street_timing) {
+                ctx.timed_street = initial_state_template.get_current_street();
+                ctx.timed_since = std::chrono::steady_clock::now();
+            }
+            run_pcs_iteration(ctx, initial_state_template, iteration_num);
+            if (config_.enable_street_timing) switch_timed_street(ctx, ctx.timed_street);
+            ctx.metrics.iterations = 1;
+            metrics_ += ctx.metrics;
+            continue;
+        }
         
         // Créer une copie de l'état initial pour cette itération
         // car GameState contient le deck et distribue les cartes.
         GameState current_hand_state = initial_state_template; 
-        // Il est crucial que initial_state_template soit "frais" ou que GameState
-        // gère correctement le re-shuffle et la re-distribution des cartes pour chaque main.
-        // Si initial_state_template est toujours le même, le deck sera le même à chaque itération.
-        // GameState::GameState constructeur fait un shuffle.
+        // Sans nouvelle donne, toutes les itérations jouent les cartes du template.
+        if (config_.chance_sampling == ChanceSampling::SAMPLE_DEAL) {
+            current_hand_state.redeal(rng_);
+        }
+
+        if (config_.board_chance != BoardChance::DEALT) {
+            current_hand_state.set_explicit_chance_nodes(true);
+        }
 
-        std::vector<double> initial_player_reach_probs(current_hand_state.get_num_players(), 1.0);
-        cfr_traverse(current_hand_state, initial_player_reach_probs, i);
+        TraversalContext ctx; // Historique vide pour la clé d'infoset
+        ctx.rng.seed_with(rng_());
+        ctx.scratch = &thread_scratch_arena();
+        ScratchArena::Frame iteration_frame(*ctx.scratch); // Arène rembobinée à chaque itération
+        if (config_.enable_street_timing) {
+            ctx.timed_street = current_hand_state.get_current_street();
+            ctx.timed_since = std::chrono::steady_clock::now();
+        }
+        // Probabilités d'atteinte des joueurs, puis du hasard
+        if (current_hand_state.get_num_players() == 2) {
+            Traversal<2>::Reach reach;
+            reach.fill(1.0);
+            cfr_traverse<2>(ctx, current_hand_state, reach, iteration_num);
+        } else {
+            Traversal<0>::Reach reach;
+            reach.fill(1.0);
+            cfr_traverse<0>(ctx, current_hand_state, reach, iteration_num);
+        }
+        if (config_.enable_street_timing) switch_timed_street(ctx, ctx.timed_street);
+        ctx.metrics.iterations = 1;
+        metrics_ += ctx.metrics;
     }
+    metrics_.training_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - batch_start).count();
     spdlog::info("CFR Entraînement terminé. {} infosets explorés.", infoset_map_.size());
 }
 
+std::string CFREngine::make_infoset_key(const TraversalContext& ctx, const GameState& state, int player,
+                                        const std::vector<Card>& hole_cards) const {
+    if (config_.transpositions == TranspositionRule::PUBLIC_STATE) {
+        return InformationSet::generate_transposition_key(player, hole_cards, state.get_board(), state.get_board_cards_dealt(),
+                                                          state.get_current_street(), state.public_state_hash());
+    }
+    return InformationSet::generate_key(player, hole_cards, state.get_board(), state.get_board_cards_dealt(),
+                                        state.get_current_street(), ctx.action_history);
+}
+
+bool CFREngine::is_pruning_iteration(int iteration_num) const {
+    if (!config_.enable_regret_pruning) return false;
+    if (iteration_num < config_.pruning_warmup_iterations) return false;
+    if (config_.pruning_full_traversal_interval > 0 &&
+        iteration_num % config_.pruning_full_traversal_interval == 0) {
+        return false; // Itération d'exploration complète
+    }
+    return true;
+}
+
+void CFREngine::switch_timed_street(TraversalContext& ctx, Street next_street) const {
+    const auto now = std::chrono::steady_clock::now();
+    ctx.metrics.street_seconds[static_cast<size_t>(ctx.timed_street)] += std::chrono::duration<double>(now - ctx.timed_since).count();
+    ctx.timed_street = next_street;
+    ctx.timed_since = now;
+}
+
+std::span<const Action> CFREngine::get_legal_actions(TraversalContext& ctx, const GameState& state,
+                                                    ScratchArena::Frame& frame) const {
+    if (legal_action_cache_) {
+        bool hit = false;
+        const std::span<const Action> actions = legal_action_cache_->get(state, &hit);
+        ctx.metrics.legal_action_lookups++;
+        if (hit) ctx.metrics.legal_action_hits++;
+        return actions;
+    }
+    const std::span<Action> action_buffer = frame.allocate<Action>(action_abstraction_.max_actions());
+    return action_buffer.first(action_abstraction_.get_abstract_actions(state, action_buffer));
+}
+
+InformationSet& CFREngine::find_or_create_infoset(TraversalContext& ctx, const std::string& infoset_key) {
+    ctx.metrics.infoset_lookups++;
+    if (ctx.overlay) {
+        // Région parallèle : infoset_map_ est en lecture seule. Les sous-arbres des
+        // différentes rivers n'ont aucun infoset en commun (le board complet fait partie de la clé).
+        auto overlay_it = ctx.overlay->find(infoset_key);
+        if (overlay_it != ctx.overlay->end()) {
+            ctx.metrics.infoset_hits++;
+            return overlay_it->second;
+        }
+        auto it = infoset_map_.find(infoset_key);
+        if (it != infoset_map_.end()) {
+            ctx.metrics.infoset_hits++;
+            return it->second;
+        }
+        return (*ctx.overlay)[infoset_key];
+    }
+    auto [it, inserted] = infoset_map_.try_emplace(infoset_key); // Crée si n'existe pas
+    if (!inserted) ctx.metrics.infoset_hits++;
+    return it->second;
+}
+
+CFRMetrics CFREngine::get_metrics() const {
+    CFRMetrics snapshot = metrics_;
+    snapshot.infoset_count = infoset_map_.size();
+    snapshot.infoset_buckets = infoset_map_.bucket_count();
+    snapshot.infoset_load_factor = infoset_map_.load_factor();
+    for (const auto& [key, node] : infoset_map_) {
+        snapshot.regret_storage_bytes += node.num_actions() * node.precision().regret_bytes();
+        snapshot.strategy_storage_bytes += node.num_actions() * node.precision().strategy_bytes();
+    }
+    return snapshot;
+}
+
+void CFREngine::reset_metrics() {
+    metrics_ = CFRMetrics{};
+}
+
 std::vector<double> CFREngine::get_average_strategy(const std::string& infoset_key) const {
     auto it = infoset_map_.find(infoset_key);
     if (it == infoset_map_.end()) {
@@ -45,17 +176,20 @@ std::vector<double> CFREngine::get_average_strategy(const std::string& infoset_k
         return {}; // Retourner une stratégie vide ou lancer une exception
     }
     const InformationSet& infoset = it->second;
-    if (infoset.visit_count == 0 || infoset.cumulative_strategy.empty()) {
+    const size_t num_actions = infoset.num_actions();
+    if (infoset.visit_count == 0 || num_actions == 0) {
         spdlog::warn("CFREngine: Infoset '{}' n'a pas été visité ou n'a pas de stratégie cumulative.", infoset_key);
         // Retourner stratégie uniforme si pas de visites ?
-        size_t num_actions = infoset.cumulative_regrets.size(); // On se base sur la taille des regrets
         if (num_actions == 0) return {};
         return std::vector<double>(num_actions, 1.0 / num_actions);
     }
 
-    std::vector<double> avg_strategy = infoset.cumulative_strategy;
+    std::vector<double> avg_strategy(num_actions);
     double sum_cumulative_strategy = 0;
-    for(double prob : avg_strategy) sum_cumulative_strategy += prob;
+    for (size_t i = 0; i < num_actions; ++i) {
+        avg_strategy[i] = infoset.get_strategy_sum(i);
+        sum_cumulative_strategy += avg_strategy[i];
+    }
 
     if (sum_cumulative_strategy > 0) {
         for (double& prob : avg_strategy) {
@@ -64,289 +198,159 @@ std::vector<double> CFREngine::get_average_strategy(const std::string& infoset_k
     } else {
         // Devrait être rare si visit_count > 0 et strategy_sum a été mis à jour.
         // Retourner uniforme par défaut.
-        size_t num_actions = infoset.cumulative_strategy.size();
-        if (num_actions == 0) return {};
         std::fill(avg_strategy.begin(), avg_strategy.end(), 1.0 / num_actions);
-        spdlog::debug("CFREngine: sum_cumulative_strategy est 0 pour '{}', retour stratégie uniforme.", infoset_key);
+        SPDLOG_DEBUG("CFREngine: sum_cumulative_strategy est 0 pour '{}', retour stratégie uniforme.", infoset_key);
     }
     return avg_strategy;
 }
 
-double CFREngine::cfr_traverse(GameState current_state, std::vector<double>& player_reach_probs, int iteration_num) {
-    // 1. Vérifier si c'est un nœud terminal (fin de la main)
-    if (current_state.get_current_player() < 0 || current_state.get_current_street() == Street::SHOWDOWN) {
-        spdlog::trace("CFR: Nœud terminal atteint. Pot: {}. Street: {}", 
-                      current_state.get_pot_size(), street_to_string(current_state.get_current_street()));
+namespace {
 
-        double p0_utility = 0.0;
-        int pot_size = current_state.get_pot_size();
+// Nombre de joueurs connu à la compilation (heads-up) ou lu dans l'état.
+template <int NumPlayers>
+int player_count(const GameState& state) {
+    if constexpr (NumPlayers > 0) {
+        return NumPlayers;
+    } else {
+        return state.get_num_players();
+    }
+}
 
-        // Pour un jeu à 2 joueurs, déterminer le statut de chaque joueur
-        bool p0_active = !current_state.is_player_folded(0);
-        bool p1_active = false;
-        if (current_state.get_num_players() > 1) {
-            p1_active = !current_state.is_player_folded(1);
+// Vrai si, pour chaque joueur, la probabilité d'atteinte de ses adversaires (hasard
+// compris, dernier élément de reach) est <= epsilon.
+template <int NumPlayers, size_t ReachSize>
+bool opponents_unreached(const std::array<double, ReachSize>& reach, int num_players, double epsilon) {
+    const double chance = reach.back();
+    if constexpr (NumPlayers == 2) {
+        return reach[1] * chance <= epsilon && reach[0] * chance <= epsilon;
+    } else {
+        for (int p = 0; p < num_players; ++p) {
+            double opponents = chance;
+            for (int q = 0; q < num_players; ++q) {
+                if (q != p) opponents *= reach[q];
+            }
+            if (opponents > epsilon) return false;
         }
+        return true;
+    }
+}
 
-        if (current_state.get_num_players() == 2) { // Logique pour 2 joueurs
-            if (p0_active && !p1_active) { // P1 a foldé, P0 gagne
-                p0_utility = static_cast<double>(pot_size) / 2.0;
-                spdlog::trace("CFR Terminal: P1 folded. P0 utility: {}", p0_utility);
-            } else if (!p0_active && p1_active) { // P0 a foldé, P1 gagne
-                p0_utility = -static_cast<double>(pot_size) / 2.0;
-                spdlog::trace("CFR Terminal: P0 folded. P0 utility: {}", p0_utility);
-            } else if (p0_active && p1_active) { // Showdown entre P0 et P1
-                spdlog::trace("CFR Terminal: Showdown P0 vs P1. Board cards: {}", current_state.get_board_cards_dealt());
-                if (current_state.get_board_cards_dealt() == 5) {
-                    const auto& p0_hand_vec = current_state.get_player_hand(0);
-                    const auto& p1_hand_vec = current_state.get_player_hand(1);
-                    const auto& board_array = current_state.get_board();
-                    std::vector<Card> board_vec;
-                    for(int k=0; k < current_state.get_board_cards_dealt(); ++k) {
-                        if(board_array[k] != INVALID_CARD) board_vec.push_back(board_array[k]);
-                    }
-
-                    if (p0_hand_vec.size() == 2 && p1_hand_vec.size() == 2 && board_vec.size() == 5) {
-                        short rank_p0 = gto_solver::evaluate_hand_7_card(p0_hand_vec[0], p0_hand_vec[1], board_vec);
-                        short rank_p1 = gto_solver::evaluate_hand_7_card(p1_hand_vec[0], p1_hand_vec[1], board_vec);
-                        
-                        if (rank_p0 == INVALID_HAND_RANK || rank_p1 == INVALID_HAND_RANK) {
-                           spdlog::error("CFR Showdown: Invalid hand rank P0 ({}) or P1 ({}). State:\n{}", rank_p0, rank_p1, current_state.toString());
-                           p0_utility = 0.0; // Erreur, traiter comme une égalité pour l'instant
-                        } else if (rank_p0 > rank_p1) { // P0 gagne
-                            p0_utility = static_cast<double>(pot_size) / 2.0;
-                        } else if (rank_p1 > rank_p0) { // P1 gagne
-                            p0_utility = -static_cast<double>(pot_size) / 2.0;
-                        } else { // Égalité
-                            p0_utility = 0.0;
-                        }
-                        spdlog::trace("CFR Showdown: P0 rank {}, P1 rank {}. P0 utility: {}", rank_p0, rank_p1, p0_utility);
-                    } else {
-                        spdlog::error("CFR Showdown: Incorrect card counts for eval. P0 hand: {}, P1 hand: {}, Board: {}. State:\n{}", 
-                                      p0_hand_vec.size(), p1_hand_vec.size(), board_vec.size(), current_state.toString());
-                        p0_utility = 0.0; // Erreur
-                    }
-                } else { // Cas où le board n'a PAS 5 cartes (showdown au Flop ou au Turn)
-                    // TODO: CRITICAL - Implémenter le calcul d'équité pour les boards incomplets.
-                    // spdlog::warn("CFR Showdown: Board non complet ({} cartes). Début calcul d'équité (placeholder).", current_state.get_board_cards_dealt());
-
-                    const auto& p0_hand_cards = current_state.get_player_hand(0); // Devrait être std::vector<Card>
-                    const auto& p1_hand_cards = current_state.get_player_hand(1); // Devrait être std::vector<Card>
-                    
-                    std::vector<Card> current_board_cards_vec;
-                    const auto& board_array_incomplete = current_state.get_board();
-                    for(int k=0; k < current_state.get_board_cards_dealt(); ++k) {
-                        if(board_array_incomplete[k] != INVALID_CARD) current_board_cards_vec.push_back(board_array_incomplete[k]);
-                    }
-
-                    int num_board_cards_dealt = current_state.get_board_cards_dealt();
-                    int cards_to_deal_for_full_board = 5 - num_board_cards_dealt;
-
-                    // Récupérer les cartes restantes dans le deck.
-                    // Cela nécessitera une nouvelle méthode dans GameState ou Deck.
-                    // Exemple: std::vector<Card> remaining_deck = current_state.get_remaining_deck_cards();
-                    // Pour l'instant, on simule un deck vide pour éviter des erreurs de compilation,
-                    // mais cela doit être remplacé par le vrai deck restant.
-                    std::vector<Card> remaining_deck = current_state.get_remaining_deck_cards(); // MODIFIÉ ICI
-
-                    if (p0_hand_cards.size() != 2 || p1_hand_cards.size() != 2) {
-                        spdlog::error("CFR Equity Calc: Incorrect player hand size for equity calculation.");
-                        p0_utility = 0.0; // Erreur
-                    } else if (remaining_deck.empty() && cards_to_deal_for_full_board > 0) {
-                         // Si on a besoin de cartes mais que le deck (simulé) est vide.
-                         // En réalité, si on arrive ici avec un deck vraiment vide, c'est une erreur de logique en amont.
-                         spdlog::error("CFR Equity Calc: Remaining deck is empty, cannot deal {} cards.", cards_to_deal_for_full_board);
-                         p0_utility = 0.0;
-                    } else if (cards_to_deal_for_full_board < 0) {
-                        spdlog::error("CFR Equity Calc: cards_to_deal_for_full_board is negative ({}), board already has {} cards.",
-                                       cards_to_deal_for_full_board, num_board_cards_dealt);
-                        p0_utility = 0.0;
-                    }
-                    else if (cards_to_deal_for_full_board == 0) { // Devrait avoir été géré par le if (board_cards_dealt == 5)
-                        spdlog::error("CFR Equity Calc: cards_to_deal_for_full_board is 0 but not caught by 5-card board logic.");
-                        p0_utility = 0.0; // Fallback, mais c'est une erreur de logique
-                    }
-                    else {
-                        // Ici, la logique pour itérer sur les combinaisons de `remaining_deck`
-                        // pour tirer `cards_to_deal_for_full_board` cartes.
-
-                        long p0_wins = 0;
-                        long p1_wins = 0;
-                        long ties = 0;
-                        long total_runouts_simulated = 0;
-
-                        // Exemple simplifié pour 1 carte à tirer (showdown au Turn)
-                        if (cards_to_deal_for_full_board == 1) {
-                            if (remaining_deck.empty()) {
-                                spdlog::error("CFR Equity Calc (1 card): Remaining deck is empty, cannot deal turn card.");
-                            } else {
-                                for (Card turn_card : remaining_deck) { 
-                                    std::vector<Card> final_board = current_board_cards_vec;
-                                    final_board.push_back(turn_card);
-                                    // Pas besoin de vérifier la validité de turn_card ici car get_remaining_deck_cards
-                                    // ne devrait retourner que des cartes valides et non utilisées.
-                                    // Il faut s'assurer que final_board a bien 4 cartes pour l'évaluation 7 cartes (2+2+3 initial + 1)
-                                    // Non, evaluate_hand_7_card attend 5 cartes de board. Il faut ajuster.
-                                    // Notre `evaluate_hand_7_card` prend 2 cartes main + 5 board.
-                                    // Ici, current_board_cards_vec a 3 cartes (Flop), on ajoute la Turn, il en manque une pour River.
-                                    // Ah, non, si cards_to_deal_for_full_board == 1, c'est qu'on est au Turn et il manque la River.
-                                    // Donc current_board_cards_vec a 4 cartes (Flop+Turn), et final_board aura 5 cartes.
-                                    // Donc, il faut que `current_board_cards_vec` ait 4 cartes (Flop+Turn) si on est ici.
-                                    // Et on ajoute la River card (appelée `turn_card` dans la boucle, renommons là `river_card_iter`)
-
-                                    if (final_board.size() == 5) { // Vérification cruciale
-                                        short rank_p0 = gto_solver::evaluate_hand_7_card(p0_hand_cards[0], p0_hand_cards[1], final_board);
-                                        short rank_p1 = gto_solver::evaluate_hand_7_card(p1_hand_cards[0], p1_hand_cards[1], final_board);
-
-                                        if (rank_p0 == INVALID_HAND_RANK || rank_p1 == INVALID_HAND_RANK) {
-                                            spdlog::error("CFR Equity Calc (1 card): Invalid hand rank during runout. P0:{}, P1:{}", rank_p0, rank_p1);
-                                            // Que faire? On peut ignorer ce runout ou compter comme égalité
-                                        } else if (rank_p0 > rank_p1) {
-                                            p0_wins++;
-                                        } else if (rank_p1 > rank_p0) {
-                                            p1_wins++;
-                                        } else {
-                                            ties++;
-                                        }
-                                        total_runouts_simulated++;
-                                    } else {
-                                        spdlog::error("CFR Equity Calc (1 card): Final board size is not 5 ({}) after adding river card. Initial board size: {}. River card: {}", 
-                                                      final_board.size(), current_board_cards_vec.size(), gto_solver::to_string(turn_card));
-                                    }
-                                }
-                            }
-                            // spdlog::debug("Equity calc for 1 card to come: Placeholder. Need actual remaining_deck and iteration.");
-                            spdlog::debug("Equity calc (1 card): total_runouts_simulated={}, p0_wins={}, p1_wins={}, ties={}",
-                                          total_runouts_simulated, p0_wins, p1_wins, ties);
-                        } 
-                        // Exemple pour 2 cartes à tirer (showdown au Flop)
-                        else if (cards_to_deal_for_full_board == 2) {
-                            if (remaining_deck.size() < 2) {
-                                spdlog::error("CFR Equity Calc (2 cards): Remaining deck size ({}) is less than 2, cannot deal turn and river.", remaining_deck.size());
-                            } else {
-                                // Combinatorics: itérer sur toutes paires de cartes de remaining_deck
-                                for (size_t i = 0; i < remaining_deck.size(); ++i) {
-                                    for (size_t j = i + 1; j < remaining_deck.size(); ++j) {
-                                        Card turn_card_candidate = remaining_deck[i];
-                                        Card river_card_candidate = remaining_deck[j];
-                                        
-                                        std::vector<Card> final_board = current_board_cards_vec; // current_board_cards_vec a 3 cartes (Flop)
-                                        final_board.push_back(turn_card_candidate);
-                                        final_board.push_back(river_card_candidate);
-
-                                        if (final_board.size() == 5) { // Vérification cruciale
-                                            short rank_p0 = gto_solver::evaluate_hand_7_card(p0_hand_cards[0], p0_hand_cards[1], final_board);
-                                            short rank_p1 = gto_solver::evaluate_hand_7_card(p1_hand_cards[0], p1_hand_cards[1], final_board);
-
-                                            if (rank_p0 == INVALID_HAND_RANK || rank_p1 == INVALID_HAND_RANK) {
-                                                spdlog::error("CFR Equity Calc (2 cards): Invalid hand rank during runout. P0:{}, P1:{}", rank_p0, rank_p1);
-                                            } else if (rank_p0 > rank_p1) {
-                                                p0_wins++;
-                                            } else if (rank_p1 > rank_p0) {
-                                                p1_wins++;
-                                            } else {
-                                                ties++;
-                                            }
-                                            total_runouts_simulated++;
-                                        } else {
-                                            spdlog::error("CFR Equity Calc (2 cards): Final board size is not 5 ({}) after adding turn/river. Initial board size: {}. Turn: {}, River: {}", 
-                                                          final_board.size(), current_board_cards_vec.size(), 
-                                                          gto_solver::to_string(turn_card_candidate), gto_solver::to_string(river_card_candidate));
-                                        }
-                                    }
-                                }
-                            }
-                            // spdlog::debug("Equity calc for 2 cards to come: Placeholder. Need actual remaining_deck and iteration.");
-                            spdlog::debug("Equity calc (2 cards): total_runouts_simulated={}, p0_wins={}, p1_wins={}, ties={}",
-                                          total_runouts_simulated, p0_wins, p1_wins, ties);
-                        }
-                        // ... autres cas si plus de cartes (ne devrait pas arriver pour Texas Holdem 5-card board)
-
-                        if (total_runouts_simulated > 0) {
-                            // Utility pour P0 : (gain si P0 gagne - gain si P1 gagne (perte pour P0))
-                            // Chaque joueur a contribué pot_size / 2 au pot s'ils sont all-in.
-                            // Ce calcul suppose que le pot est partagé équitablement en cas d'égalité.
-                            // L'utilité est du point de vue de P0.
-                            // Si P0 gagne, il récupère sa mise et gagne celle de P1 => gain net = mise_P1 = pot_size / 2
-                            // Si P0 perd, il perd sa mise => perte net = -mise_P0 = -pot_size / 2
-                            p0_utility = (static_cast<double>(p0_wins - p1_wins) / total_runouts_simulated) * (static_cast<double>(pot_size) / 2.0);
-                            spdlog::debug("CFR Equity Calc Result: P0 wins {}, P1 wins {}, Ties {}. Total runouts {}. P0 Utility: {:.4f}", 
-                                          p0_wins, p1_wins, ties, total_runouts_simulated, p0_utility);
-                        } else {
-                            spdlog::warn("CFR Equity Calc: No runouts simulated for board with {} cards. Utility set to 0.", num_board_cards_dealt);
-                            p0_utility = 0.0; // Fallback si aucune simulation n'a eu lieu
-                        }
-                    }
-                }
-            } else { // Cas imprévu à 2 joueurs (ex: les deux inactifs mais pas de fold clair?)
-                 spdlog::warn("CFR Terminal: État ambigu pour 2 joueurs (P0 active: {}, P1 active: {}). Pot: {}. Utility = 0.", p0_active, p1_active, pot_size);
-                 p0_utility = 0.0;
-            }
-        } else { // Plus de 2 joueurs ou moins de 2 (ne devrait pas arriver pour un jeu standard)
-            spdlog::warn("CFR Terminal: Calcul d'utilité non implémenté pour {} joueurs. Utility = 0.", current_state.get_num_players());
-            p0_utility = 0.0;
+// total += weight * values, sur les num_players premières composantes
+template <size_t Seats>
+void add_weighted(std::array<double, Seats>& total, const std::array<double, Seats>& values, double weight, int num_players) {
+    for (int p = 0; p < num_players; ++p) total[p] += weight * values[p];
+}
+
+} // namespace
+
+template <int NumPlayers>
+typename CFREngine::Traversal<NumPlayers>::Utilities
+CFREngine::cfr_traverse(TraversalContext& ctx, GameState current_state,
+                        typename Traversal<NumPlayers>::Reach& player_reach_probs, int iteration_num) {
+    using Utilities = typename Traversal<NumPlayers>::Utilities;
+    ctx.metrics.nodes_visited++;
+    if (config_.enable_reach_pruning &&
+        opponents_unreached<NumPlayers>(player_reach_probs, player_count<NumPlayers>(current_state), config_.reach_pruning_epsilon)) {
+        ctx.metrics.reach_pruned_subtrees++;
+        return Utilities{}; // Pondéré par une probabilité adverse nulle partout au-dessus
+    }
+    if (config_.enable_street_timing) switch_timed_street(ctx, current_state.get_current_street());
+
+    // 0. Nœud de hasard explicite (carte(s) de board à tirer)
+    if (current_state.is_chance_node()) {
+        return chance_traverse<NumPlayers>(ctx, current_state, player_reach_probs, iteration_num);
+    }
+
+    // 1. Vérifier si c'est un nœud terminal (fin de la main)
+    if (current_state.is_terminal()) {
+        ctx.metrics.terminal_evaluations++;
+        SPDLOG_TRACE("CFR: Nœud terminal atteint. Pot: {}. Street: {}",
+                      current_state.get_pot_size(), street_to_string(current_state.get_current_street()));
+        if constexpr (NumPlayers == 2) {
+            const double p0_utility = heads_up_terminal_utility(current_state, ctx.metrics.hand_evaluations,
+                                                                &ctx.rng, config_.terminal_runout_samples);
+            return Utilities{p0_utility, -p0_utility}; // Somme nulle
+        } else {
+            return terminal_utilities(current_state, ctx.metrics.hand_evaluations, // Pots secondaires compris
+                                      &ctx.rng, config_.terminal_runout_samples);
         }
-        return p0_utility;
     }
 
     int current_player = current_state.get_current_player();
 
     // 2. Générer la clé de l'infoset et récupérer/créer le nœud d'information
-    std::string infoset_key = InformationSet::generate_key(
-        current_player,
-        current_state.get_player_hand(current_player),
-        current_state.get_board(),
-        current_state.get_board_cards_dealt(),
-        current_state.get_current_street(),
-        current_hand_action_history_
-    );
+    std::string infoset_key = make_infoset_key(ctx, current_state, current_player,
+                                               current_state.get_player_hand(current_player));
     
-    InformationSet& infoset_node = infoset_map_[infoset_key]; // Crée si n'existe pas
+    InformationSet& infoset_node = find_or_create_infoset(ctx, infoset_key);
 
-    std::vector<Action> legal_actions = current_state.get_legal_abstract_actions(action_abstraction_);    
-    if (legal_actions.empty()) {
+    // Tampons du nœud dans l'arène du thread
+    ScratchArena::Frame frame(*ctx.scratch);
+    const std::span<const Action> legal_actions = get_legal_actions(ctx, current_state, frame);
+    const size_t num_actions = legal_actions.size();
+    if (num_actions == 0) {
         // Cela ne devrait pas arriver si le nœud n'est pas terminal.
         // GameState ou ActionAbstraction pourrait avoir un problème.
         spdlog::error("CFR: Aucune action légale pour un nœud non terminal! Infoset: {}. State:\n{}", infoset_key, current_state.toString());
         // Forcer un abandon ou retourner une valeur d'erreur?
         // Pour l'instant, on suppose que ça n'arrive pas ou que c'est un bug à corriger ailleurs.
-        return 0.0; // Valeur d'erreur ou de repli
+        return Utilities{}; // Valeur d'erreur ou de repli
     }
 
-    if (infoset_node.cumulative_regrets.empty() || infoset_node.cumulative_regrets.size() != legal_actions.size()) {
-        infoset_node.initialize(legal_actions.size());
+    if (infoset_node.num_actions() != num_actions) {
+        infoset_node.initialize(num_actions, config_.storage_precision);
         infoset_node.key = infoset_key; // S'assurer que la clé est stockée
     }
 
     // 3. Obtenir la stratégie actuelle pour cet infoset
-    std::vector<double> current_strategy = infoset_node.get_current_strategy();
-    double node_value = 0.0; // Valeur de cet état pour le joueur courant
-    std::vector<double> action_values(legal_actions.size(), 0.0);
+    const std::span<double> current_strategy = frame.allocate<double>(num_actions);
+    infoset_node.get_current_strategy(current_strategy);
+    const int num_players = player_count<NumPlayers>(current_state);
+    Utilities node_values{}; // Valeur de cet état pour chaque joueur
+    const std::span<double> action_values = frame.allocate<double>(num_actions); // Pour le joueur courant
+    const std::span<bool> explored = frame.allocate<bool>(num_actions);
+    std::fill(action_values.begin(), action_values.end(), 0.0);
+    std::fill(explored.begin(), explored.end(), true);
+    const bool pruning = is_pruning_iteration(iteration_num);
 
     // 4. Itérer sur chaque action légale
-    for (size_t i = 0; i < legal_actions.size(); ++i) {
+    for (size_t i = 0; i < num_actions; ++i) {
         const Action& action = legal_actions[i];
         GameState next_state = current_state; // Copie pour simuler l'action
-        
-        current_hand_action_history_.push_back(action); // Ajouter l'action à l'historique
         next_state.apply_action(action);
+
+        // Élagage : une action de probabilité nulle ne contribue pas à node_value ;
+        // on garde les actions terminales (évaluation bon marché, regret toujours à jour).
+        // Les stratégies cumulées adverses du sous-arbre sautent aussi cette itération
+        // (voir CFREngineConfig::enable_regret_pruning).
+        if (pruning && current_strategy[i] == 0.0 &&
+            infoset_node.get_regret(i) < config_.pruning_threshold &&
+            !next_state.is_terminal()) {
+            explored[i] = false;
+            ctx.metrics.pruned_branches++;
+            continue;
+        }
+
+        ctx.action_history.push_back(action); // Ajouter l'action à l'historique
         
         // Mettre à jour les probabilités d'atteinte pour le joueur qui vient d'agir
-        std::vector<double> next_player_reach_probs = player_reach_probs;
+        typename Traversal<NumPlayers>::Reach next_player_reach_probs = player_reach_probs;
         next_player_reach_probs[current_player] *= current_strategy[i];
 
-        double child_node_value_for_current_player = cfr_traverse(next_state, next_player_reach_probs, iteration_num);
+        const Utilities child_values = cfr_traverse<NumPlayers>(ctx, next_state, next_player_reach_probs, iteration_num);
+        if (config_.enable_street_timing) switch_timed_street(ctx, current_state.get_current_street());
         
-        current_hand_action_history_.pop_back(); // Retirer l'action de l'historique (backtrack)
+        ctx.action_history.pop_back(); // Retirer l'action de l'historique (backtrack)
 
-        action_values[i] = child_node_value_for_current_player; // Valeur de prendre cette action
-        node_value += current_strategy[i] * child_node_value_for_current_player;
+        action_values[i] = child_values[current_player]; // Valeur de prendre cette action
+        add_weighted(node_values, child_values, current_strategy[i], num_players);
     }
+    const double node_value = node_values[current_player];
 
     // 5. Mettre à jour les regrets et la stratégie cumulée pour le joueur courant (Vanilla CFR)
     double p_i = player_reach_probs[current_player]; // Probabilité que le joueur courant atteigne ce nœud
-    double p_opp = 1.0; // Probabilité que les opposants atteignent ce nœud
-    for(int p = 0; p < current_state.get_num_players(); ++p) {
+    double p_opp = player_reach_probs.back(); // Probabilité que le hasard et les opposants atteignent ce nœud
+    for (int p = 0; p < num_players; ++p) {
         if (p != current_player) {
             p_opp *= player_reach_probs[p];
         }
@@ -355,10 +359,12 @@ double CFREngine::cfr_traverse(GameState current_state, std::vector<double>& pla
     // Mettre à jour les regrets cumulés
     // regret_for_action = action_value - node_value
     // cumulative_regret += p_opp * regret_for_action
-    std::vector<double> immediate_regrets(legal_actions.size());
-    for (size_t i = 0; i < legal_actions.size(); ++i) {
-        immediate_regrets[i] = action_values[i] - node_value;
-        infoset_node.cumulative_regrets[i] += p_opp * immediate_regrets[i];
+    for (size_t i = 0; i < num_actions; ++i) {
+        if (!explored[i]) continue; // Regret d'une action élaguée : inchangé
+        if (infoset_node.add_regret(i, p_opp * (action_values[i] - node_value))) {
+            ctx.metrics.regret_rescales++;
+            SPDLOG_DEBUG("Regrets de {} divisés par 2 (dépassement int32).", infoset_node.key);
+        }
     }
     // infoset_node.update_regrets(action_values, node_value); // L'ancienne méthode ne pondère pas
     // On pourrait créer une nouvelle méthode: update_cumulative_regrets(const std::vector<double>& immediate_regrets, double opponent_reach_prob)
@@ -366,47 +372,301 @@ double CFREngine::cfr_traverse(GameState current_state, std::vector<double>& pla
 
     // Mettre à jour la somme des stratégies
     // cumulative_strategy += p_i * current_strategy_action_prob
-    std::vector<double> weighted_strategy_to_sum = current_strategy;
-    for(double& prob_s : weighted_strategy_to_sum) {
+    // (current_strategy n'est plus lue : pondérée sur place)
+    for (double& prob_s : current_strategy) {
         prob_s *= p_i;
     }
-    infoset_node.update_strategy_sum(weighted_strategy_to_sum);
+    infoset_node.update_strategy_sum(current_strategy, ctx.rng);
     // Le visit_count est incrémenté dans update_strategy_sum, ce qui est ok.
     // Si on voulait un visit_count pondéré, il faudrait le passer.
 
-    return node_value;
+    return node_values;
 }
 
-// --- Sauvegarde / Chargement --- 
+template <int NumPlayers>
+typename CFREngine::Traversal<NumPlayers>::Utilities
+CFREngine::chance_traverse(TraversalContext& ctx, const GameState& state,
+                           typename Traversal<NumPlayers>::Reach& player_reach_probs, int iteration_num) {
+    ctx.metrics.chance_nodes++;
+    const Bitboard known_cards = FULL_DECK & ~state.get_remaining_deck_mask();
+
+    // Flop, et tout tirage en mode SAMPLE : une carte tirée (poids 1, le hasard
+    // est échantillonné selon sa propre loi).
+    if (config_.board_chance == BoardChance::SAMPLE || state.get_board_cards_dealt() < 3) {
+        GameState next_state = state;
+        next_state.deal_board_card(sample_chance_outcome(known_cards, ctx.rng));
+        return cfr_traverse<NumPlayers>(ctx, next_state, player_reach_probs, iteration_num);
+    }
 
-bool CFREngine::save_infoset_map(const std::string& filename) const {
-    std::ofstream outfile(filename);
-    if (!outfile.is_open()) {
-        spdlog::error("Impossible d'ouvrir le fichier de sauvegarde : {}", filename);
-        return false;
+    const std::vector<ChanceOutcome> outcomes = enumerate_chance_outcomes(known_cards, config_.suit_isomorphic_chance, &ctx.rng);
+    const int threads = config_.chance_threads > 0 ? config_.chance_threads
+                                                   : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    // River uniquement : sous-arbres sans infoset commun (voir CFREngineConfig::chance_threads).
+    if (threads > 1 && ctx.overlay == nullptr && outcomes.size() > 1 && state.get_board_cards_dealt() == 4) {
+        return parallel_chance_traverse<NumPlayers>(ctx, state, outcomes, player_reach_probs, iteration_num);
     }
 
-    spdlog::info("Sauvegarde de {} infosets dans {}...", infoset_map_.size(), filename);
-    outfile << std::fixed << std::setprecision(10); // Précision pour les doubles
+    // Même dérivation des graines qu'en parallèle : résultat indépendant de chance_threads.
+    const uint64_t base_seed = ctx.rng();
+    const Rng parent_rng = ctx.rng;
+    const int num_players = player_count<NumPlayers>(state);
+    typename Traversal<NumPlayers>::Utilities values{};
+    for (size_t i = 0; i < outcomes.size(); ++i) {
+        ctx.rng.seed_with(derive_seed(base_seed, i));
+        GameState next_state = state;
+        next_state.deal_board_card(outcomes[i].card);
+        typename Traversal<NumPlayers>::Reach next_reach = player_reach_probs;
+        next_reach.back() *= outcomes[i].probability;
+        add_weighted(values, cfr_traverse<NumPlayers>(ctx, next_state, next_reach, iteration_num), outcomes[i].probability, num_players);
+        if (config_.enable_street_timing) switch_timed_street(ctx, state.get_current_street());
+    }
+    ctx.rng = parent_rng;
+    return values;
+}
 
-    for (const auto& pair : infoset_map_) {
-        const std::string& key = pair.first;
-        const InformationSet& node = pair.second;
+template <int NumPlayers>
+typename CFREngine::Traversal<NumPlayers>::Utilities
+CFREngine::parallel_chance_traverse(TraversalContext& ctx, const GameState& state,
+                                    const std::vector<ChanceOutcome>& outcomes,
+                                    const typename Traversal<NumPlayers>::Reach& player_reach_probs, int iteration_num) {
+    using Utilities = typename Traversal<NumPlayers>::Utilities;
+    const int requested = config_.chance_threads > 0 ? config_.chance_threads
+                                                     : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int num_workers = std::min(requested, static_cast<int>(outcomes.size()));
+    const uint64_t base_seed = ctx.rng();
+    if (config_.enable_street_timing) switch_timed_street(ctx, state.get_current_street());
+
+    std::vector<Utilities> values(outcomes.size());
+    std::vector<InformationSetMap> overlays(num_workers);
+    std::vector<CFRMetrics> worker_metrics(num_workers);
+    std::atomic<size_t> next_outcome{0};
+
+    auto worker = [&](int w) {
+        TraversalContext worker_ctx;
+        worker_ctx.action_history = ctx.action_history;
+        worker_ctx.overlay = &overlays[w];
+        worker_ctx.scratch = &thread_scratch_arena(); // Worker 0 : arène du thread appelant, empilée
+        worker_ctx.timed_street = state.get_current_street();
+        worker_ctx.timed_since = std::chrono::steady_clock::now();
+        for (size_t i = next_outcome++; i < outcomes.size(); i = next_outcome++) {
+            // Graine par issue : résultat indépendant de la répartition entre threads
+            worker_ctx.rng.seed_with(derive_seed(base_seed, i));
+            GameState next_state = state;
+            next_state.deal_board_card(outcomes[i].card);
+            typename Traversal<NumPlayers>::Reach next_reach = player_reach_probs;
+            next_reach.back() *= outcomes[i].probability;
+            values[i] = cfr_traverse<NumPlayers>(worker_ctx, next_state, next_reach, iteration_num);
+        }
+        if (config_.enable_street_timing) switch_timed_street(worker_ctx, worker_ctx.timed_street);
+        worker_metrics[w] = worker_ctx.metrics;
+    };
+
+    std::vector<std::thread> threads;
+    for (int w = 1; w < num_workers; ++w) threads.emplace_back(worker, w);
+    worker(0);
+    for (auto& t : threads) t.join();
+
+    // Fusion : les infosets créés pendant la région sont absents de infoset_map_.
+    for (auto& overlay : overlays) infoset_map_.merge(overlay);
+    for (const auto& m : worker_metrics) ctx.metrics += m;
+    if (config_.enable_street_timing) ctx.timed_since = std::chrono::steady_clock::now();
+
+    const int num_players = player_count<NumPlayers>(state);
+    Utilities value{};
+    for (size_t i = 0; i < outcomes.size(); ++i) add_weighted(value, values[i], outcomes[i].probability, num_players);
+    return value;
+}
+
+namespace {
+
+// C(45, 2) : mains adverses compatibles avec une main donnée sur un board complet.
+// Les valeurs PCS sont ramenées à une moyenne par main adverse : mêmes unités (jetons)
+// que les regrets de la traversée vanilla.
+constexpr double OPPONENT_COMBOS_PER_HAND = 990.0;
+
+void pcs_terminal_values(const GameState& state, int player, std::span<const double> opp_reach,
+                         const BoardRanking& ranking, std::span<double> out) {
+    const int opponent = 1 - player;
+    if (state.is_player_folded(player)) {
+        fold_values(opp_reach, -state.get_player_contribution(player) / OPPONENT_COMBOS_PER_HAND, out);
+    } else if (state.is_player_folded(opponent)) {
+        fold_values(opp_reach, state.get_player_contribution(opponent) / OPPONENT_COMBOS_PER_HAND, out);
+    } else {
+        const double stake = std::min(state.get_player_contribution(player), state.get_player_contribution(opponent));
+        showdown_values(opp_reach, ranking.hand_ranks, ranking.sorted_combos, stake / OPPONENT_COMBOS_PER_HAND, out);
+    }
+}
 
-        // Format: cle;visit_count;regret1,regret2,...;strat1,strat2,...
-        outfile << key << ";" << node.visit_count << ";";
+} // namespace
+
+void CFREngine::run_pcs_iteration(TraversalContext& ctx, const GameState& initial_state, int iteration_num) {
+    // Les mains privées sont portées par les ranges ; le board est fourni par les nœuds de hasard.
+    GameState root_state = initial_state;
+    root_state.clear_private_cards();
+    root_state.set_explicit_chance_nodes(true);
+
+    std::array<Card, 5> board = root_state.get_board();
+    const int dealt = root_state.get_board_cards_dealt();
+    deal_cards(FULL_DECK & ~root_state.get_remaining_deck_mask(), 5 - dealt, ctx.rng, board.data() + dealt);
+    const BoardRanking ranking = rank_hole_combos(board);
+    ctx.metrics.hand_evaluations += ranking.valid_combos;
+
+    ScratchArena::Frame frame(*ctx.scratch);
+    const std::span<double> root_reach = frame.allocate<double>(NUM_HOLE_COMBOS);
+    const std::span<double> values = frame.allocate<double>(NUM_HOLE_COMBOS);
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) root_reach[h] = ranking.hand_ranks[h] == INVALID_HAND_RANK ? 0.0 : 1.0;
+    const std::array<std::span<const double>, 2> reach = {root_reach, root_reach};
+    for (int update_player = 0; update_player < 2; ++update_player) {
+        ctx.action_history.clear();
+        pcs_traverse(ctx, root_state, update_player, reach, ranking, iteration_num, values);
+    }
+}
 
-        // Écrire les regrets cumulés
-        for (size_t i = 0; i < node.cumulative_regrets.size(); ++i) {
-            outfile << node.cumulative_regrets[i] << (i == node.cumulative_regrets.size() - 1 ? "" : ",");
+void CFREngine::pcs_traverse(TraversalContext& ctx, GameState current_state, int update_player,
+                             const std::array<std::span<const double>, 2>& reach, const BoardRanking& ranking,
+                             int iteration_num, std::span<double> values) {
+    ctx.metrics.nodes_visited++;
+    if (config_.enable_street_timing) switch_timed_street(ctx, current_state.get_current_street());
+
+    // Hasard public : cartes du board tiré pour cette itération
+    if (current_state.is_chance_node()) {
+        ctx.metrics.chance_nodes++;
+        while (current_state.is_chance_node()) {
+            current_state.deal_board_card(ranking.board[current_state.get_board_cards_dealt()]);
         }
-        outfile << ";";
+        pcs_traverse(ctx, current_state, update_player, reach, ranking, iteration_num, values);
+        return;
+    }
+
+    if (current_state.is_terminal()) {
+        ctx.metrics.terminal_evaluations++;
+        pcs_terminal_values(current_state, update_player, reach[1 - update_player], ranking, values);
+        return;
+    }
 
-        // Écrire la stratégie cumulée
-        for (size_t i = 0; i < node.cumulative_strategy.size(); ++i) {
-            outfile << node.cumulative_strategy[i] << (i == node.cumulative_strategy.size() - 1 ? "" : ",");
+    // Tampons du nœud dans l'arène du thread
+    ScratchArena::Frame frame(*ctx.scratch);
+    const int acting_player = current_state.get_current_player();
+    const std::span<const Action> legal_actions = get_legal_actions(ctx, current_state, frame);
+    if (legal_actions.empty()) {
+        spdlog::error("CFR PCS: Aucune action légale pour un nœud non terminal! State:\n{}", current_state.toString());
+        std::fill(values.begin(), values.end(), 0.0);
+        return;
+    }
+    const size_t num_actions = legal_actions.size();
+
+    // Partie de la clé commune à toutes les mains, calculée une seule fois par nœud
+    const std::string public_key = make_infoset_key(ctx, current_state, acting_player, {});
+    const std::string key_prefix = "P" + std::to_string(acting_player) + ";";
+    const std::string key_suffix = public_key.substr(public_key.find('|'));
+    const auto& hole_strings = hole_combo_strings();
+
+    // Stratégie courante de chaque main du joueur qui agit (infosets créés au besoin).
+    // Mains du joueur mis à jour : toutes celles compatibles avec le board (regrets
+    // contrefactuels) ; mains adverses : seulement celles qui atteignent le nœud.
+    const std::span<const double> acting_reach = reach[acting_player];
+    const std::span<InformationSet*> nodes = frame.allocate<InformationSet*>(NUM_HOLE_COMBOS);
+    const std::span<double> strategies = frame.allocate<double>(NUM_HOLE_COMBOS * num_actions);
+    std::fill(nodes.begin(), nodes.end(), nullptr);
+    std::fill(strategies.begin(), strategies.end(), 0.0);
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (ranking.hand_ranks[h] == INVALID_HAND_RANK) continue;
+        if (acting_player != update_player && acting_reach[h] == 0.0) continue;
+        const std::string infoset_key = key_prefix + hole_strings[h] + key_suffix;
+        InformationSet& infoset_node = find_or_create_infoset(ctx, infoset_key);
+        if (infoset_node.num_actions() != num_actions) {
+            infoset_node.initialize(num_actions, config_.storage_precision);
+            infoset_node.key = infoset_key;
         }
-        outfile << "\n"; // Nouvelle ligne pour le prochain infoset
+        nodes[h] = &infoset_node;
+        infoset_node.get_current_strategy(strategies.subspan(h * num_actions, num_actions));
+    }
+
+    // Joueur mis à jour : valeurs de chaque action (regrets) ; adversaire : un seul tampon réutilisé
+    const bool updating = acting_player == update_player;
+    const std::span<double> action_values = frame.allocate<double>((updating ? num_actions : 1) * NUM_HOLE_COMBOS);
+    const std::span<double> acting_child_reach = frame.allocate<double>(NUM_HOLE_COMBOS);
+    std::array<std::span<const double>, 2> child_reach = reach;
+    child_reach[acting_player] = acting_child_reach;
+    std::fill(values.begin(), values.end(), 0.0);
+    for (size_t a = 0; a < num_actions; ++a) {
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            acting_child_reach[h] = acting_reach[h] * strategies[h * num_actions + a];
+        }
+        const std::span<double> child_values = action_values.subspan((updating ? a : 0) * NUM_HOLE_COMBOS, NUM_HOLE_COMBOS);
+        GameState next_state = current_state;
+        next_state.apply_action(legal_actions[a]);
+        ctx.action_history.push_back(legal_actions[a]);
+        pcs_traverse(ctx, next_state, update_player, child_reach, ranking, iteration_num, child_values);
+        if (config_.enable_street_timing) switch_timed_street(ctx, current_state.get_current_street());
+        ctx.action_history.pop_back();
+
+        if (updating) {
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+                values[h] += strategies[h * num_actions + a] * child_values[h];
+            }
+        } else {
+            // Les valeurs sont déjà pondérées par la range adverse de chaque branche
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += child_values[h];
+        }
+    }
+
+    if (updating) {
+        const std::span<double> weighted_strategy = frame.allocate<double>(num_actions);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (!nodes[h]) continue;
+            for (size_t a = 0; a < num_actions; ++a) {
+                if (nodes[h]->add_regret(a, action_values[a * NUM_HOLE_COMBOS + h] - values[h])) {
+                    ctx.metrics.regret_rescales++;
+                    SPDLOG_DEBUG("Regrets de {} divisés par 2 (dépassement int32).", nodes[h]->key);
+                }
+                weighted_strategy[a] = acting_reach[h] * strategies[h * num_actions + a];
+            }
+            nodes[h]->update_strategy_sum(weighted_strategy, ctx.rng);
+        }
+    }
+}
+
+// --- Sauvegarde / Chargement --- 
+
+namespace {
+
+// Précision d'écriture des doubles : max_digits10 chiffres significatifs suffisent pour que
+// std::stod relise exactement la même valeur (base + deltas rechargés = carte vivante, bit à bit).
+void set_checkpoint_precision(std::ostream& out) {
+    out << std::defaultfloat << std::setprecision(std::numeric_limits<double>::max_digits10);
+}
+
+// Format: cle;visit_count;regret1,regret2,...;strat1,strat2,...
+void write_infoset_line(std::ostream& out, const InformationSet& node) {
+    out << node.key << ";" << node.visit_count << ";";
+
+    // Écrire les regrets cumulés (toujours en double, indépendamment de la précision de stockage)
+    const size_t num_actions = node.num_actions();
+    for (size_t i = 0; i < num_actions; ++i) {
+        out << node.get_regret(i) << (i == num_actions - 1 ? "" : ",");
+    }
+    out << ";";
+
+    // Écrire la stratégie cumulée
+    for (size_t i = 0; i < num_actions; ++i) {
+        out << node.get_strategy_sum(i) << (i == num_actions - 1 ? "" : ",");
+    }
+    out << "\n"; // Nouvelle ligne pour le prochain infoset
+}
+
+bool write_infoset_file(const std::string& filename, const InformationSetMap& infoset_map) {
+    std::ofstream outfile(filename);
+    if (!outfile.is_open()) {
+        spdlog::error("Impossible d'ouvrir le fichier de sauvegarde : {}", filename);
+        return false;
+    }
+
+    spdlog::info("Sauvegarde de {} infosets dans {}...", infoset_map.size(), filename);
+    set_checkpoint_precision(outfile);
+
+    for (const auto& pair : infoset_map) {
+        write_infoset_line(outfile, pair.second);
     }
 
     outfile.close();
@@ -419,14 +679,18 @@ bool CFREngine::save_infoset_map(const std::string& filename) const {
     return true;
 }
 
-bool CFREngine::load_infoset_map(const std::string& filename) {
+// Lit un checkpoint (complet ou delta) et fusionne ses entrées dans infoset_map,
+// stockées avec la précision demandée.
+// Une clé présente plusieurs fois (deltas successifs) garde sa dernière valeur.
+// Les lignes vides et les commentaires ('#') sont ignorés.
+bool read_infoset_file(const std::string& filename, InformationSetMap& infoset_map,
+                       const StoragePrecision& precision) {
     std::ifstream infile(filename);
     if (!infile.is_open()) {
         spdlog::warn("Impossible d'ouvrir le fichier de chargement : {}. Aucun infoset chargé.", filename);
         return false; // Pas forcément une erreur si le fichier n'existe pas au premier lancement
     }
 
-    infoset_map_.clear(); // Vider la map actuelle avant de charger
     std::string line;
     long line_count = 0;
     long loaded_count = 0;
@@ -435,15 +699,21 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
 
     while (std::getline(infile, line)) {
         line_count++;
+        if (line.empty() || line[0] == '#') continue;
+
         bool parse_error = false; // Drapeau pour gérer les erreurs sans goto
-        std::stringstream ss_line(line);
-        std::string segment;
         std::vector<std::string> parts;
 
-        // Séparer par le délimiteur principal ';'
-        while (std::getline(ss_line, segment, ';')) {
-            parts.push_back(segment);
+        // Séparer par le délimiteur principal ';' en partant de la droite :
+        // la clé elle-même contient un ';' ("P0;As-Kd|...").
+        size_t end_pos = line.size();
+        for (int field = 0; field < 3; ++field) {
+            size_t sep = line.rfind(';', end_pos == 0 ? 0 : end_pos - 1);
+            if (sep == std::string::npos || end_pos == 0) break;
+            parts.insert(parts.begin(), line.substr(sep + 1, end_pos - sep - 1));
+            end_pos = sep;
         }
+        parts.insert(parts.begin(), line.substr(0, end_pos));
 
         if (parts.size() != 4) { // clé;visits;regrets;strategie
             spdlog::error("Erreur de format ligne {}: Nombre incorrect de segments ({}). Ligne: {}", line_count, parts.size(), line);
@@ -452,10 +722,13 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
 
         InformationSet node;
         node.key = parts[0];
+        int visit_count = 0;
+        std::vector<double> regrets;
+        std::vector<double> strategy_sums;
 
         // Parser visit_count
         try {
-            node.visit_count = std::stoll(parts[1]); // Utiliser stoll pour long long
+            visit_count = std::stoll(parts[1]); // Utiliser stoll pour long long
         } catch (const std::exception& e) {
             spdlog::error("Erreur de format ligne {}: Impossible de parser visit_count '{}'. Raison: {}. Ligne: {}", 
                           line_count, parts[1], e.what(), line);
@@ -467,7 +740,7 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
         std::string regret_val_str;
         while (std::getline(ss_regrets, regret_val_str, ',')) {
             try {
-                node.cumulative_regrets.push_back(std::stod(regret_val_str)); // Utiliser stod pour double
+                regrets.push_back(std::stod(regret_val_str)); // Utiliser stod pour double
             } catch (const std::exception& e) {
                 spdlog::error("Erreur de format ligne {}: Impossible de parser la valeur de regret '{}'. Raison: {}. Ligne: {}", 
                               line_count, regret_val_str, e.what(), line);
@@ -483,7 +756,7 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
         std::string strategy_val_str;
         while (std::getline(ss_strategy, strategy_val_str, ',')) {
             try {
-                node.cumulative_strategy.push_back(std::stod(strategy_val_str));
+                strategy_sums.push_back(std::stod(strategy_val_str));
             } catch (const std::exception& e) {
                 spdlog::error("Erreur de format ligne {}: Impossible de parser la valeur de stratégie '{}'. Raison: {}. Ligne: {}", 
                               line_count, strategy_val_str, e.what(), line);
@@ -495,14 +768,22 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
         if (parse_error) continue; // Passer à la ligne suivante si erreur dans la stratégie
 
         // Vérifier la cohérence des tailles (optionnel mais utile)
-        if (node.cumulative_regrets.size() != node.cumulative_strategy.size()) {
+        if (regrets.size() != strategy_sums.size()) {
              spdlog::error("Erreur de format ligne {}: Tailles incohérentes pour regrets ({}) et stratégie ({}). Ligne: {}", 
-                           line_count, node.cumulative_regrets.size(), node.cumulative_strategy.size(), line);
+                           line_count, regrets.size(), strategy_sums.size(), line);
              continue; // Passer à la ligne suivante
         }
 
-        // Si tout s'est bien passé, ajouter à la map
-        infoset_map_[node.key] = std::move(node); // Utiliser move pour efficacité
+        node.initialize(regrets.size(), precision);
+        for (size_t i = 0; i < regrets.size(); ++i) {
+            node.set_regret(i, regrets[i]);
+            node.set_strategy_sum(i, strategy_sums[i]);
+        }
+
+        // Si tout s'est bien passé, ajouter à la map (un infoset chargé est "propre")
+        node.visit_count = visit_count;
+        node.dirty = false;
+        infoset_map[node.key] = std::move(node); // Utiliser move pour efficacité
         loaded_count++;
     }
 
@@ -511,4 +792,80 @@ bool CFREngine::load_infoset_map(const std::string& filename) {
     return true;
 }
 
+} // namespace
+
+bool CFREngine::save_infoset_map(const std::string& filename) const {
+    return write_infoset_file(filename, infoset_map_);
+}
+
+bool CFREngine::load_infoset_map(const std::string& filename) {
+    infoset_map_.clear(); // Vider la map actuelle avant de charger
+    return read_infoset_file(filename, infoset_map_, config_.storage_precision);
+}
+
+bool CFREngine::save_infoset_delta(const std::string& filename) {
+    std::ofstream outfile(filename, std::ios::app);
+    if (!outfile.is_open()) {
+        spdlog::error("Impossible d'ouvrir le fichier delta : {}", filename);
+        return false;
+    }
+
+    const size_t dirty_count = count_dirty_infosets();
+    set_checkpoint_precision(outfile);
+    outfile << "# delta " << dirty_count << " infosets\n";
+    for (const auto& pair : infoset_map_) {
+        if (pair.second.dirty) {
+            write_infoset_line(outfile, pair.second);
+        }
+    }
+
+    outfile.close();
+    if (outfile.fail()) {
+        spdlog::error("Erreur lors de l'écriture du fichier delta : {}", filename);
+        return false;
+    }
+
+    // Ne nettoyer les drapeaux qu'une fois l'écriture confirmée
+    clear_dirty_flags();
+    spdlog::info("Checkpoint delta : {} / {} infosets ajoutés à {}.", dirty_count, infoset_map_.size(), filename);
+    return true;
+}
+
+bool CFREngine::apply_infoset_delta(const std::string& filename) {
+    return read_infoset_file(filename, infoset_map_, config_.storage_precision);
+}
+
+void CFREngine::clear_dirty_flags() {
+    for (auto& pair : infoset_map_) {
+        pair.second.dirty = false;
+    }
+}
+
+size_t CFREngine::count_dirty_infosets() const {
+    size_t count = 0;
+    for (const auto& pair : infoset_map_) {
+        if (pair.second.dirty) count++;
+    }
+    return count;
+}
+
+bool CFREngine::compact_checkpoints(const std::string& base_filename,
+                                    const std::vector<std::string>& delta_filenames,
+                                    const std::string& output_filename) {
+    // La compaction travaille en double : aucune perte de précision entre base et sortie.
+    const StoragePrecision lossless{};
+    InformationSetMap merged;
+    if (!read_infoset_file(base_filename, merged, lossless)) {
+        spdlog::error("Compaction : checkpoint de base {} illisible.", base_filename);
+        return false;
+    }
+    for (const auto& delta_filename : delta_filenames) {
+        if (!read_infoset_file(delta_filename, merged, lossless)) {
+            spdlog::error("Compaction : delta {} illisible.", delta_filename);
+            return false;
+        }
+    }
+    return write_infoset_file(output_filename, merged);
+}
+
 } 
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "gto/cfr_metrics.h"
+#include "gto/game_utils.hpp" // Pour street_to_string
+#include "spdlog/spdlog.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace gto_solver {
+
+CFRMetrics& CFRMetrics::operator+=(const CFRMetrics& other) {
+    iterations += other.iterations;
+    training_seconds += other.training_seconds;
+    nodes_visited += other.nodes_visited;
+    terminal_evaluations += other.terminal_evaluations;
+    chance_nodes += other.chance_nodes;
+    hand_evaluations += other.hand_evaluations;
+    infoset_lookups += other.infoset_lookups;
+    infoset_hits += other.infoset_hits;
+    pruned_branches += other.pruned_branches;
+    reach_pruned_subtrees += other.reach_pruned_subtrees;
+    legal_action_lookups += other.legal_action_lookups;
+    legal_action_hits += other.legal_action_hits;
+    regret_rescales += other.regret_rescales;
+    for (size_t i = 0; i < street_seconds.size(); ++i) street_seconds[i] += other.street_seconds[i];
+    return *this;
+}
+
+std::string CFRMetrics::to_json() const {
+    std::ostringstream ss;
+    ss << std::setprecision(6)
+       << "{\"iterations\":" << iterations
+       << ",\"training_seconds\":" << training_seconds
+       << ",\"iterations_per_second\":" << iterations_per_second()
+       << ",\"nodes_visited\":" << nodes_visited
+       << ",\"nodes_per_second\":" << nodes_per_second()
+       << ",\"terminal_evaluations\":" << terminal_evaluations
+       << ",\"chance_nodes\":" << chance_nodes
+       << ",\"hand_evaluations\":" << hand_evaluations
+       << ",\"infoset_lookups\":" << infoset_lookups
+       << ",\"infoset_hit_rate\":" << infoset_hit_rate()
+       << ",\"pruned_branches\":" << pruned_branches
+       << ",\"reach_pruned_subtrees\":" << reach_pruned_subtrees
+       << ",\"legal_action_lookups\":" << legal_action_lookups
+       << ",\"legal_action_hit_rate\":" << legal_action_hit_rate()
+       << ",\"regret_rescales\":" << regret_rescales
+       << ",\"infoset_count\":" << infoset_count
+       << ",\"infoset_buckets\":" << infoset_buckets
+       << ",\"infoset_load_factor\":" << infoset_load_factor
+       << ",\"regret_storage_bytes\":" << regret_storage_bytes
+       << ",\"strategy_storage_bytes\":" << strategy_storage_bytes
+       << ",\"street_seconds\":{";
+    for (size_t i = 0; i < street_seconds.size(); ++i) {
+        ss << (i == 0 ? "" : ",") << "\"" << street_to_string(static_cast<Street>(i)) << "\":" << street_seconds[i];
+    }
+    ss << "}}";
+    return ss.str();
+}
+
+bool append_metrics_json_line(const std::string& filename, const CFRMetrics& metrics) {
+    std::ofstream out(filename, std::ios::app);
+    if (!out.is_open()) {
+        spdlog::error("Impossible d'ouvrir le fichier de métriques : {}", filename);
+        return false;
+    }
+    out << metrics.to_json() << "\n";
+    return !out.fail();
+}
+
+} // namespace gto_solver
@@ -0,0 +1,71 @@
+#include "gto/chance.h"
+#include "core/deck.hpp" // Pour draw_card
+#include <array>
+
+namespace gto_solver {
+
+namespace {
+
+constexpr Bitboard SUIT_RANKS_MASK = (1ULL << 13) - 1;
+
+// Rangs des cartes connues dans une couleur (13 bits) ; carte = couleur * 13 + rang.
+Bitboard suit_ranks(Bitboard cards, int suit) {
+    return (cards >> (13 * suit)) & SUIT_RANKS_MASK;
+}
+
+} // namespace
+
+std::vector<ChanceOutcome> enumerate_chance_outcomes(Bitboard known_cards, bool suit_isomorphic, Rng* rng) {
+    const Bitboard available = FULL_DECK & ~known_cards;
+    const int num_available = count_set_bits(available);
+    std::vector<ChanceOutcome> outcomes;
+    if (num_available == 0) return outcomes;
+    const double p = 1.0 / num_available;
+
+    if (!suit_isomorphic) {
+        outcomes.reserve(num_available);
+        Bitboard remaining = available;
+        while (remaining) outcomes.push_back({pop_lsb(remaining), p});
+        return outcomes;
+    }
+
+    // Classes de couleurs : même ensemble de rangs connus.
+    std::array<int, 4> class_size{};
+    std::array<int, 4> representative{0, 1, 2, 3};
+    for (int s = 0; s < 4; ++s) {
+        for (int r = 0; r < s; ++r) {
+            if (representative[r] == r && suit_ranks(known_cards, r) == suit_ranks(known_cards, s)) {
+                representative[s] = r;
+                break;
+            }
+        }
+        class_size[representative[s]]++;
+    }
+
+    for (int s = 0; s < 4; ++s) {
+        if (representative[s] != s) continue;
+        // Couleur dont les cartes représentent la classe (mêmes rangs disponibles dans toutes)
+        int chosen = s;
+        if (rng && class_size[s] > 1) {
+            int pick = static_cast<int>(rng->uniform(static_cast<uint32_t>(class_size[s])));
+            for (int t = s; t < 4; ++t) {
+                if (representative[t] == s && pick-- == 0) {
+                    chosen = t;
+                    break;
+                }
+            }
+        }
+        Bitboard suit_cards = (available >> (13 * chosen)) & SUIT_RANKS_MASK;
+        while (suit_cards) {
+            const int rank = pop_lsb(suit_cards);
+            outcomes.push_back({static_cast<Card>(13 * chosen + rank), p * class_size[s]});
+        }
+    }
+    return outcomes;
+}
+
+Card sample_chance_outcome(Bitboard known_cards, Rng& rng) {
+    return draw_card(FULL_DECK & ~known_cards, rng);
+}
+
+} // namespace gto_solver
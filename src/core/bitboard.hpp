@@ -5,6 +5,9 @@
 #include <string>
 #include <vector>
 #include <iostream> // Pour l'affichage?
+#if defined(__BMI2__)
+#include <immintrin.h> // _pdep_u64
+#endif
 
 // Inclure cards.hpp pour les types Card, Rank, Suit
 #include "core/cards.hpp"
@@ -85,6 +88,17 @@ inline Card pop_lsb(Bitboard& board) {
     return static_cast<Card>(lsb_index);
 }
 
+// Carte de rang n (0 = plus petit index) parmi les bits de mask. Suppose n < count_set_bits(mask).
+// PDEP (BMI2) en une instruction si disponible, sinon n suppressions du LSB.
+inline Card select_nth_card(Bitboard mask, int n) {
+#if defined(__BMI2__)
+    return static_cast<Card>(bit_scan_forward(_pdep_u64(1ULL << n, mask)));
+#else
+    for (int i = 0; i < n; ++i) mask &= mask - 1;
+    return static_cast<Card>(bit_scan_forward(mask));
+#endif
+}
+
 // Fonctions de conversion
 std::string board_to_string(Bitboard board); // Affichage lisible
 std::vector<Card> board_to_cards(Bitboard board);
@@ -1,47 +1,44 @@
 #include "core/deck.hpp"
-#include "core/bitboard.hpp"
 #include <stdexcept> 
-#include <random>
-#include <algorithm>
-#include <numeric>
 
 namespace gto_solver {
 
-Deck::Deck()
-    : cards_(NUM_CARDS),
-      next_card_index_(0)
+Deck::Deck() : Deck(thread_rng()()) {}
+
+Deck::Deck(uint64_t seed)
+    : remaining_(FULL_DECK),
+      rng_(seed)
 {
-    std::iota(cards_.begin(), cards_.end(), 0); 
-    std::random_device rd;
-    rng_.seed(rd());
-    // Shuffle initialement
-    shuffle(); 
 }
 
 void Deck::reset() {
-    next_card_index_ = 0;
     shuffle();
 }
 
 Card Deck::deal_card() {
-    if (next_card_index_ >= cards_.size()) {
+    if (remaining_ == EMPTY_BOARD) {
         throw std::runtime_error("Deck is empty, cannot deal card.");
     }
-    return cards_[next_card_index_++];
+    const Card c = draw_card(remaining_, rng_);
+    clear_card(remaining_, c);
+    return c;
 }
 
 void Deck::burn_card() {
-    if (next_card_index_ >= cards_.size()) {
-        // Optionnel: Gérer l'erreur si on essaie de brûler dans un deck vide
-        // throw std::runtime_error("Deck empty, cannot burn card.");
+    if (remaining_ == EMPTY_BOARD) {
         return; 
     }
-    next_card_index_++; // Simplement ignorer la prochaine carte
+    clear_card(remaining_, draw_card(remaining_, rng_));
 }
 
 void Deck::shuffle() {
-    std::shuffle(cards_.begin(), cards_.end(), rng_);
-    next_card_index_ = 0;
+    remaining_ = FULL_DECK;
+}
+
+void Deck::shuffle(Rng& rng) {
+    // La donne ne dépend que de l'état de rng.
+    rng_.seed_with(rng());
+    remaining_ = FULL_DECK;
 }
 
-} // namespace gto_solver 
\ No newline at end of file
+} // namespace gto_solver
@@ -2,46 +2,67 @@
 #define GTO_CORE_DECK_HPP
 
 #include "core/cards.hpp"
-#include <vector>
-#include <random>
-#include <algorithm> // Pour std::shuffle
+#include "core/bitboard.hpp"
+#include "core/rng.hpp"
 #include <stdexcept> // Pour std::runtime_error
 
 namespace gto_solver {
 
+// Tire une carte uniforme parmi available (non vide).
+// Masque dense : rejet sur [0, 52) (moins de 2 tirages en moyenne) ;
+// masque creux : sélection directe du n-ième bit (select_nth_card).
+inline Card draw_card(Bitboard available, Rng& rng) {
+    const int n = count_set_bits(available);
+    if (n >= NUM_CARDS / 2) {
+        while (true) {
+            const Card c = static_cast<Card>(rng.uniform(NUM_CARDS));
+            if (test_card(available, c)) return c;
+        }
+    }
+    return select_nth_card(available, static_cast<int>(rng.uniform(static_cast<uint32_t>(n))));
+}
+
+// Tire k cartes distinctes uniformes hors de excluded. Les cartes sont écrites dans
+// out (k places) si out n'est pas nul ; retourne le masque des cartes tirées.
+inline Bitboard deal_cards(Bitboard excluded, int k, Rng& rng, Card* out = nullptr) {
+    Bitboard available = FULL_DECK & ~excluded;
+    if (count_set_bits(available) < k) throw std::runtime_error("deal_cards: pas assez de cartes restantes");
+    Bitboard dealt = EMPTY_BOARD;
+    for (int i = 0; i < k; ++i) {
+        const Card c = draw_card(available, rng);
+        clear_card(available, c);
+        set_card(dealt, c);
+        if (out) out[i] = c;
+    }
+    return dealt;
+}
+
+// Deck sous forme de masque des cartes restantes : chaque carte distribuée est tirée
+// uniformément parmi les restantes (aucun mélange des 52 cartes). 40 octets, copie triviale :
+// deux copies d'un même deck distribuent les mêmes cartes.
 class Deck {
 public:
+    // Graine tirée du générateur du thread (thread_rng) : reproductible à graine fixée.
     Deck();
+    explicit Deck(uint64_t seed);
     ~Deck() = default;
 
     Card deal_card();
     void burn_card();
-    void shuffle();
+    void shuffle();          // Remet les 52 cartes ; tirages suivants avec le générateur interne
+    void shuffle(Rng& rng);  // Idem, générateur interne réinitialisé depuis rng (celui du thread de traversée)
     void reset();
 
-    void initialize() {
-        cards_.clear();
-        cards_.reserve(52);
-        for (int s = 0; s < 4; ++s) {
-            for (int r = 0; r < 13; ++r) {
-                Card card = make_card(static_cast<Rank>(r), static_cast<Suit>(s));
-                cards_.push_back(card);
-            }
-        }
-        next_card_index_ = 0;
-        shuffled_ = false;
-    }
-
-    // Peut-être ajouter une méthode pour retirer des cartes spécifiques (dead cards)
-    // void remove_card(const Card& card);
+    // Retire des cartes mortes (déjà connues) du deck.
+    void remove_cards(Bitboard dead_cards) { remaining_ &= ~dead_cards; }
+    Bitboard remaining_mask() const { return remaining_; }
+    int remaining_count() const { return count_set_bits(remaining_); }
 
 private:
-    std::vector<Card> cards_;
-    size_t            next_card_index_;
-    bool shuffled_ = false;
-    std::mt19937      rng_;
+    Bitboard remaining_ = FULL_DECK;
+    Rng      rng_;
 };
 
 } // namespace gto_solver
 
-#endif // GTO_CORE_DECK_HPP 
\ No newline at end of file
+#endif // GTO_CORE_DECK_HPP
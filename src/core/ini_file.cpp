@@ -0,0 +1,190 @@
+#include "core/ini_file.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace gto_solver {
+
+namespace {
+
+std::string trim(const std::string& text) {
+    const auto is_space = [](unsigned char c) { return std::isspace(c) != 0; };
+    auto begin = std::find_if_not(text.begin(), text.end(), is_space);
+    auto end = std::find_if_not(text.rbegin(), std::string::const_reverse_iterator(begin), is_space).base();
+    return std::string(begin, end);
+}
+
+std::string to_lower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+    return text;
+}
+
+// Retire un commentaire de fin de ligne (';' ou '#' en début de ligne ou précédé d'un blanc).
+std::string strip_comment(const std::string& line) {
+    for (size_t i = 0; i < line.size(); ++i) {
+        if ((line[i] == ';' || line[i] == '#') && (i == 0 || std::isspace(static_cast<unsigned char>(line[i - 1])))) {
+            return line.substr(0, i);
+        }
+    }
+    return line;
+}
+
+std::invalid_argument value_error(const std::string& section, const std::string& key, const std::string& value,
+                                  const char* expected) {
+    return std::invalid_argument("[" + section + "] " + key + ": '" + value + "' n'est pas " + expected);
+}
+
+template <typename T>
+T parse_number(const std::string& section, const std::string& key, const std::string& text, const char* expected) {
+    T value{};
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+    if (first != last && *first == '+') ++first; // from_chars refuse le '+'
+    const auto [ptr, ec] = std::from_chars(first, last, value);
+    if (ec != std::errc() || ptr != last || text.empty()) throw value_error(section, key, text, expected);
+    return value;
+}
+
+std::vector<std::string> split_list(const std::string& text) {
+    std::vector<std::string> items;
+    if (trim(text).empty()) return items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) items.push_back(trim(item));
+    return items;
+}
+
+} // namespace
+
+IniFile IniFile::parse(std::istream& in, const std::string& source_name) {
+    IniFile ini;
+    std::string section;
+    std::string line;
+    int line_number = 0;
+    auto error = [&](const std::string& message) {
+        return std::runtime_error(source_name + ":" + std::to_string(line_number) + ": " + message);
+    };
+    while (std::getline(in, line)) {
+        ++line_number;
+        const std::string content = trim(strip_comment(line));
+        if (content.empty()) continue;
+        if (content.front() == '[') {
+            if (content.back() != ']') throw error("section non fermée : " + content);
+            section = to_lower(trim(content.substr(1, content.size() - 2)));
+            if (section.empty()) throw error("nom de section vide");
+            if (!ini.has_section(section)) {
+                ini.values_[section];
+                ini.section_order_.push_back(section);
+            }
+            continue;
+        }
+        const size_t equals = content.find('=');
+        if (equals == std::string::npos) throw error("'cle = valeur' attendu : " + content);
+        const std::string key = to_lower(trim(content.substr(0, equals)));
+        if (key.empty()) throw error("clé vide");
+        auto& entries = ini.values_[section];
+        if (entries.count(key)) throw error("clé '" + key + "' en double dans [" + section + "]");
+        if (section.empty() && entries.empty() && !ini.has_section("")) ini.section_order_.insert(ini.section_order_.begin(), "");
+        entries[key] = trim(content.substr(equals + 1));
+    }
+    return ini;
+}
+
+IniFile IniFile::parse_string(const std::string& text, const std::string& source_name) {
+    std::istringstream in(text);
+    return parse(in, source_name);
+}
+
+IniFile IniFile::load(const std::string& filename) {
+    std::ifstream in(filename);
+    if (!in) throw std::runtime_error("IniFile::load: impossible d'ouvrir " + filename);
+    return parse(in, filename);
+}
+
+bool IniFile::has_section(const std::string& section) const {
+    return std::find(section_order_.begin(), section_order_.end(), to_lower(section)) != section_order_.end();
+}
+
+bool IniFile::has(const std::string& section, const std::string& key) const {
+    return get(section, key).has_value();
+}
+
+std::vector<std::string> IniFile::keys(const std::string& section) const {
+    std::vector<std::string> result;
+    auto it = values_.find(to_lower(section));
+    if (it != values_.end()) {
+        for (const auto& [key, value] : it->second) result.push_back(key);
+    }
+    return result;
+}
+
+void IniFile::require_known_keys(const std::string& section, std::initializer_list<std::string_view> allowed) const {
+    for (const std::string& key : keys(section)) {
+        if (std::find(allowed.begin(), allowed.end(), key) == allowed.end()) {
+            throw std::invalid_argument("[" + to_lower(section) + "] clé inconnue : " + key);
+        }
+    }
+}
+
+std::optional<std::string> IniFile::get(const std::string& section, const std::string& key) const {
+    auto section_it = values_.find(to_lower(section));
+    if (section_it == values_.end()) return std::nullopt;
+    auto key_it = section_it->second.find(to_lower(key));
+    if (key_it == section_it->second.end()) return std::nullopt;
+    return key_it->second;
+}
+
+std::string IniFile::get_string(const std::string& section, const std::string& key, const std::string& fallback) const {
+    return get(section, key).value_or(fallback);
+}
+
+int IniFile::get_int(const std::string& section, const std::string& key, int fallback) const {
+    const auto value = get(section, key);
+    return value ? parse_number<int>(section, key, *value, "un entier") : fallback;
+}
+
+long long IniFile::get_int64(const std::string& section, const std::string& key, long long fallback) const {
+    const auto value = get(section, key);
+    return value ? parse_number<long long>(section, key, *value, "un entier") : fallback;
+}
+
+double IniFile::get_double(const std::string& section, const std::string& key, double fallback) const {
+    const auto value = get(section, key);
+    return value ? parse_number<double>(section, key, *value, "un nombre") : fallback;
+}
+
+bool IniFile::get_bool(const std::string& section, const std::string& key, bool fallback) const {
+    const auto value = get(section, key);
+    if (!value) return fallback;
+    const std::string text = to_lower(*value);
+    if (text == "true" || text == "yes" || text == "on" || text == "1") return true;
+    if (text == "false" || text == "no" || text == "off" || text == "0") return false;
+    throw value_error(section, key, *value, "un booléen");
+}
+
+std::vector<double> IniFile::get_double_list(const std::string& section, const std::string& key) const {
+    std::vector<double> result;
+    for (const std::string& item : split_list(get_string(section, key))) {
+        result.push_back(parse_number<double>(section, key, item, "une liste de nombres"));
+    }
+    return result;
+}
+
+std::vector<int> IniFile::get_int_list(const std::string& section, const std::string& key) const {
+    std::vector<int> result;
+    for (const std::string& item : split_list(get_string(section, key))) {
+        result.push_back(parse_number<int>(section, key, item, "une liste d'entiers"));
+    }
+    return result;
+}
+
+void IniFile::set(const std::string& section, const std::string& key, const std::string& value) {
+    const std::string name = to_lower(section);
+    if (!has_section(name)) section_order_.push_back(name);
+    values_[name][to_lower(key)] = trim(value);
+}
+
+} // namespace gto_solver
@@ -0,0 +1,58 @@
+#ifndef GTO_CORE_INI_FILE_HPP
+#define GTO_CORE_INI_FILE_HPP
+
+#include <initializer_list>
+#include <istream>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gto_solver {
+
+// Fichier de configuration déclaratif au format INI :
+//   [section]
+//   cle = valeur        ; commentaire (';' ou '#', en début de ligne ou après un blanc)
+//   liste = 0.5, 1.0    ; listes séparées par des virgules
+// Les noms de sections et de clés sont insensibles à la casse (stockés en minuscules).
+// Les clés situées avant la première section appartiennent à la section "".
+// Erreurs de syntaxe : std::runtime_error "<source>:<ligne>: <message>".
+// Valeurs mal typées : std::invalid_argument "[section] cle: <message>".
+class IniFile {
+public:
+    static IniFile parse(std::istream& in, const std::string& source_name = "<flux>");
+    static IniFile parse_string(const std::string& text, const std::string& source_name = "<texte>");
+    // Lève std::runtime_error si le fichier ne peut pas être ouvert.
+    static IniFile load(const std::string& filename);
+
+    bool has_section(const std::string& section) const;
+    bool has(const std::string& section, const std::string& key) const;
+    // Sections dans l'ordre d'apparition.
+    const std::vector<std::string>& sections() const { return section_order_; }
+    std::vector<std::string> keys(const std::string& section) const;
+    // Lève std::invalid_argument si la section contient une clé hors de allowed (faute de frappe).
+    void require_known_keys(const std::string& section, std::initializer_list<std::string_view> allowed) const;
+
+    std::optional<std::string> get(const std::string& section, const std::string& key) const;
+    std::string get_string(const std::string& section, const std::string& key, const std::string& fallback = "") const;
+    int get_int(const std::string& section, const std::string& key, int fallback = 0) const;
+    long long get_int64(const std::string& section, const std::string& key, long long fallback = 0) const;
+    double get_double(const std::string& section, const std::string& key, double fallback = 0.0) const;
+    // true/false, yes/no, on/off, 1/0.
+    bool get_bool(const std::string& section, const std::string& key, bool fallback = false) const;
+    // Listes : une valeur vide donne une liste vide.
+    std::vector<double> get_double_list(const std::string& section, const std::string& key) const;
+    std::vector<int> get_int_list(const std::string& section, const std::string& key) const;
+
+    // Ajoute ou remplace une valeur (surcharges en ligne de commande).
+    void set(const std::string& section, const std::string& key, const std::string& value);
+
+private:
+    std::map<std::string, std::map<std::string, std::string>> values_;
+    std::vector<std::string> section_order_;
+};
+
+} // namespace gto_solver
+
+#endif // GTO_CORE_INI_FILE_HPP
@@ -0,0 +1,21 @@
+#include "core/rng.hpp"
+#include <atomic>
+
+namespace gto_solver {
+
+namespace {
+
+std::atomic<uint64_t> next_thread_ordinal{0};
+
+} // namespace
+
+Rng& thread_rng() {
+    thread_local Rng rng(derive_seed(DEFAULT_RNG_SEED, next_thread_ordinal++));
+    return rng;
+}
+
+void seed_thread_rng(uint64_t seed) {
+    thread_rng().seed_with(seed);
+}
+
+} // namespace gto_solver
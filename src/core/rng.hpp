@@ -0,0 +1,111 @@
+#ifndef GTO_CORE_RNG_HPP
+#define GTO_CORE_RNG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace gto_solver {
+
+// Mélangeur splitmix64 : dérive des graines décorrélées à partir d'une graine et d'un index
+// (une graine par itération, par thread, par échantillon...).
+constexpr uint64_t splitmix64(uint64_t x) {
+    uint64_t z = x + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+constexpr uint64_t derive_seed(uint64_t seed, uint64_t index) {
+    return splitmix64(seed ^ splitmix64(index + 1));
+}
+
+// Générateur xoshiro256** (Blackman & Vigna) : 32 octets d'état, rapide, copiable
+// à bas coût. Conforme à UniformRandomBitGenerator (utilisable avec <random>).
+class Xoshiro256 {
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256(uint64_t seed = 0) { seed_with(seed); }
+
+    void seed_with(uint64_t seed) {
+        // L'état est initialisé par splitmix64 (jamais entièrement nul).
+        for (size_t i = 0; i < state_.size(); ++i) {
+            state_[i] = splitmix64(seed + i * 0x9E3779B97F4A7C15ULL);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    // Entier uniforme dans [0, bound) (méthode de Lemire, sans biais). bound > 0.
+    uint32_t uniform(uint32_t bound) {
+        uint64_t m = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * bound;
+        uint32_t low = static_cast<uint32_t>(m);
+        if (low < bound) {
+            const uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                m = static_cast<uint64_t>(static_cast<uint32_t>((*this)() >> 32)) * bound;
+                low = static_cast<uint32_t>(m);
+            }
+        }
+        return static_cast<uint32_t>(m >> 32);
+    }
+
+    // Réel uniforme dans [0, 1).
+    double uniform_real() { return ((*this)() >> 11) * 0x1.0p-53; }
+
+    // Avance de 2^128 tirages : des flux disjoints pour chaque worker.
+    void jump() {
+        static constexpr std::array<uint64_t, 4> JUMP = {
+            0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+        std::array<uint64_t, 4> s{};
+        for (uint64_t word : JUMP) {
+            for (int b = 0; b < 64; ++b) {
+                if (word & (1ULL << b)) {
+                    for (int i = 0; i < 4; ++i) s[i] ^= state_[i];
+                }
+                (*this)();
+            }
+        }
+        state_ = s;
+    }
+
+    // Copie de ce générateur avancée de (stream + 1) sauts : flux indépendant et reproductible.
+    Xoshiro256 fork(unsigned stream) const {
+        Xoshiro256 child = *this;
+        for (unsigned i = 0; i <= stream; ++i) child.jump();
+        return child;
+    }
+
+private:
+    static constexpr uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::array<uint64_t, 4> state_{};
+};
+
+// Générateur utilisé par le solveur (interchangeable tant que l'interface est conservée).
+using Rng = Xoshiro256;
+
+// Générateur propre au thread appelant. Graine par défaut déterministe :
+// dérivée de DEFAULT_RNG_SEED et de l'ordre de premier appel des threads.
+constexpr uint64_t DEFAULT_RNG_SEED = 0x5EEDC0FFEEULL;
+Rng& thread_rng();
+void seed_thread_rng(uint64_t seed);
+
+} // namespace gto_solver
+
+#endif // GTO_CORE_RNG_HPP
@@ -0,0 +1,40 @@
+#include "core/scratch_arena.hpp"
+#include <algorithm>
+
+namespace gto_solver {
+
+void* ScratchArena::allocate_bytes(size_t bytes, size_t alignment) {
+    // Bloc courant, puis les suivants déjà réservés (libérés par un release), puis un nouveau bloc
+    while (current_ < blocks_.size()) {
+        Block& block = blocks_[current_];
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        const uintptr_t aligned = (base + offset_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        if (aligned + bytes <= base + block.size) {
+            offset_ = aligned + bytes - base;
+            return reinterpret_cast<void*>(aligned);
+        }
+        ++current_;
+        offset_ = 0;
+    }
+    // Les nouveaux blocs (alignés pour tout type fondamental) suffisent toujours à la requête
+    Block block;
+    block.size = std::max(block_bytes_, bytes + alignment);
+    block.data.reset(new std::byte[block.size]);
+    blocks_.push_back(std::move(block));
+    current_ = blocks_.size() - 1;
+    offset_ = 0;
+    return allocate_bytes(bytes, alignment);
+}
+
+size_t ScratchArena::reserved_bytes() const {
+    size_t total = 0;
+    for (const Block& block : blocks_) total += block.size;
+    return total;
+}
+
+ScratchArena& thread_scratch_arena() {
+    thread_local ScratchArena arena;
+    return arena;
+}
+
+} // namespace gto_solver
@@ -0,0 +1,89 @@
+#ifndef GTO_CORE_SCRATCH_ARENA_HPP
+#define GTO_CORE_SCRATCH_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace gto_solver {
+
+// Arène de pile (bump allocator) pour les tampons temporaires d'une traversée récursive :
+// chaque niveau ouvre un Frame, y alloue ses tampons, et tout est rendu à la sortie du
+// Frame (ordre LIFO). Les blocs ne sont jamais libérés avant la destruction de l'arène :
+// une fois la profondeur maximale atteinte, plus aucune allocation système.
+// Les pointeurs restent valides jusqu'à la fermeture de leur Frame (pas de réallocation :
+// un nouveau bloc est chaîné quand le bloc courant est plein).
+class ScratchArena {
+public:
+    // Position dans l'arène (bloc courant, octet courant).
+    struct Marker {
+        size_t block = 0;
+        size_t offset = 0;
+    };
+
+    // Portée RAII : restaure la position de l'arène à la destruction.
+    class Frame {
+    public:
+        explicit Frame(ScratchArena& arena) : arena_(arena), marker_(arena.mark()) {}
+        ~Frame() { arena_.release(marker_); }
+        Frame(const Frame&) = delete;
+        Frame& operator=(const Frame&) = delete;
+
+        template <typename T>
+        std::span<T> allocate(size_t count) { return arena_.allocate<T>(count); }
+
+    private:
+        ScratchArena& arena_;
+        Marker marker_;
+    };
+
+    explicit ScratchArena(size_t block_bytes = DEFAULT_BLOCK_BYTES) : block_bytes_(block_bytes) {}
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    // Tableau non initialisé de count éléments (types trivialement copiables uniquement).
+    template <typename T>
+    std::span<T> allocate(size_t count) {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "ScratchArena: types triviaux uniquement (aucun destructeur appelé)");
+        void* p = allocate_bytes(count * sizeof(T), alignof(T));
+        return {static_cast<T*>(p), count};
+    }
+
+    Marker mark() const { return {current_, offset_}; }
+    void release(const Marker& marker) {
+        current_ = marker.block;
+        offset_ = marker.offset;
+    }
+    // Rend tout l'espace (début d'itération) ; les blocs sont conservés.
+    void reset() { release({}); }
+
+    // Octets réservés au système (somme des blocs) : stable une fois la profondeur maximale atteinte.
+    size_t reserved_bytes() const;
+    size_t block_count() const { return blocks_.size(); }
+
+    static constexpr size_t DEFAULT_BLOCK_BYTES = 64 * 1024;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    void* allocate_bytes(size_t bytes, size_t alignment);
+
+    std::vector<Block> blocks_;
+    size_t current_ = 0; // Bloc courant
+    size_t offset_ = 0;  // Premier octet libre du bloc courant
+    size_t block_bytes_;
+};
+
+// Arène propre au thread appelant (une par thread de traversée).
+ScratchArena& thread_scratch_arena();
+
+} // namespace gto_solver
+
+#endif // GTO_CORE_SCRATCH_ARENA_HPP
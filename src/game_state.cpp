@@ -3,12 +3,14 @@
 #include "spdlog/spdlog.h"             // Logging
 #include <stdexcept>                    // Standard
 #include <algorithm>                    // Standard
+#include <limits>                       // Standard
 #include <string>                       // Standard
 #include <vector>                       // Standard
 #include <sstream>                      // Standard
 #include "core/cards.hpp"              // Interne relatif
 #include "core/deck.hpp"               // Interne relatif
 #include "core/bitboard.hpp" // Pour NUM_CARDS
+#include "core/rng.hpp"      // Pour splitmix64
 
 // --- Constantes ---
 // const int SB_SIZE = 1; // Devenu obsolète, utiliser big_blind_size_ / 2
@@ -20,33 +22,36 @@ namespace gto_solver {
 //  Constructeur / Destructeur
 // -----------------------------------------------------------------------------
 GameState::GameState(int num_players, int initial_stack, int ante, int button_pos, int big_blind_size)
-    : num_players_          (num_players),
-      stacks_               (num_players, initial_stack),
-      current_bets_         (num_players, 0),
+    : GameState(std::vector<int>(std::max(0, num_players), initial_stack), ante, button_pos, big_blind_size) {}
+
+GameState::GameState(const std::vector<int>& initial_stacks, int ante, int button_pos, int big_blind_size)
+    : num_players_          (static_cast<int>(initial_stacks.size())),
+      stacks_               (initial_stacks),
+      current_bets_         (num_players_, 0),
       pot_size_             (0),
       current_player_index_ (-1), // Sera défini par le début du jeu
       last_raise_size_      (0), // Sera la BB initialement
-      button_pos_           (button_pos % num_players),
+      button_pos_           (num_players_ > 0 ? button_pos % num_players_ : 0),
       ante_                 (ante),
       big_blind_size_       (big_blind_size), // Initialiser le nouveau membre
       current_street_       (Street::PREFLOP),
       deck_                 (),
-      player_hands_         (num_players, std::vector<Card>(2, INVALID_CARD)),
+      player_hands_         (num_players_, std::vector<Card>(2, INVALID_CARD)),
       board_                (),
       board_cards_dealt_    (0),
-      has_folded_           (num_players, false),
-      last_aggressor_index_ (-1)
+      has_folded_           (num_players_, false),
+      last_aggressor_index_ (-1),
+      contributions_        (num_players_, 0)
 {
-    if (num_players <= 0) throw std::invalid_argument("Num players must be > 0");
-    if (initial_stack < 0) throw std::invalid_argument("Initial stack >= 0");
+    if (num_players_ <= 0) throw std::invalid_argument("Num players must be > 0");
+    if (num_players_ > MAX_PLAYERS) throw std::invalid_argument("Num players must be <= MAX_PLAYERS");
+    for (int stack : stacks_) {
+        if (stack < 0) throw std::invalid_argument("Initial stack >= 0");
+    }
     std::fill(board_.begin(), board_.end(), INVALID_CARD);
 
     deck_.shuffle();
-    for (int i = 0; i < num_players_ * 2; ++i) {
-        const int player = i % num_players_;
-        const int hole   = i / num_players_;
-        if (hole < 2) player_hands_[player][hole] = deck_.deal_card();
-    }
+    deal_hole_cards();
 
     // Logique pour poster les antes et les blinds
     // Antes
@@ -55,6 +60,7 @@ GameState::GameState(int num_players, int initial_stack, int ante, int button_po
             int ante_to_post = std::min(stacks_[i], ante_);
             stacks_[i] -= ante_to_post;
             current_bets_[i] += ante_to_post; // Les antes font partie des mises initiales
+            contributions_[i] += ante_to_post;
             pot_size_ += ante_to_post;
         }
     }
@@ -76,6 +82,7 @@ GameState::GameState(int num_players, int initial_stack, int ante, int button_po
         int sb_to_post = std::min(stacks_[sb_player], small_blind_amount);
         stacks_[sb_player] -= sb_to_post;
         current_bets_[sb_player] += sb_to_post;
+        contributions_[sb_player] += sb_to_post;
         pot_size_ += sb_to_post;
 
         // Big Blind (seulement si plus d'un joueur, sinon SB a déjà posté)
@@ -85,6 +92,7 @@ GameState::GameState(int num_players, int initial_stack, int ante, int button_po
             int bb_to_post = std::min(stacks_[bb_player], big_blind_amount);
             stacks_[bb_player] -= bb_to_post;
             current_bets_[bb_player] += bb_to_post;
+            contributions_[bb_player] += bb_to_post;
             pot_size_ += bb_to_post;
             last_raise_size_ = big_blind_amount; // La BB est la première "relance" à battre
             last_aggressor_index_ = bb_player; // Le BB est le premier agresseur
@@ -103,8 +111,8 @@ GameState::GameState(int num_players, int initial_stack, int ante, int button_po
         current_player_index_ = 0;
     }
     // Distribuer les cartes privées (2 cartes par joueur pour Hold'em)
-    spdlog::debug("GameState initialisé: {} joueurs, stack {}, BTN {}, Pot {}, Mises: {}, Premier: {}",
-                  num_players_, initial_stack, button_pos_, pot_size_, fmt::join(current_bets_, ","), current_player_index_);
+    SPDLOG_DEBUG("GameState initialisé: {} joueurs, stacks {}, BTN {}, Pot {}, Mises: {}, Premier: {}",
+                  num_players_, fmt::join(initial_stacks, ","), button_pos_, pot_size_, fmt::join(current_bets_, ","), current_player_index_);
 }
 
 GameState::~GameState() = default;
@@ -122,7 +130,51 @@ const std::array<Card, 5>& GameState::get_board() const { return board_; }
 int GameState::get_board_cards_dealt() const { return board_cards_dealt_; }
 const std::vector<Card>& GameState::get_player_hand(int i) const { if (i<0||i>=num_players_) throw std::out_of_range("Idx joueur"); return player_hands_.at(i); }
 bool GameState::is_player_folded(int i) const { if (i<0||i>=num_players_) throw std::out_of_range("Idx joueur"); return has_folded_.at(i); }
+void GameState::deal_hole_cards() {
+    for (int i = 0; i < num_players_ * 2; ++i) {
+        const int player = i % num_players_;
+        const int hole   = i / num_players_;
+        if (hole < 2) player_hands_[player][hole] = deck_.deal_card();
+    }
+}
+
+void GameState::redeal(Rng& rng) {
+    if (board_cards_dealt_ > 0) throw std::logic_error("redeal: board déjà distribué");
+    deck_.shuffle(rng);
+    deal_hole_cards();
+}
+
+void GameState::clear_private_cards() {
+    for (auto& hand : player_hands_) std::fill(hand.begin(), hand.end(), INVALID_CARD);
+}
+
 int GameState::get_num_players() const { return num_players_; }
+int GameState::get_player_contribution(int i) const { if (i<0||i>=num_players_) throw std::out_of_range("Idx joueur"); return contributions_.at(i); }
+
+std::vector<SidePot> GameState::get_side_pots() const {
+    // Niveaux de mise distincts des joueurs encore en main, croissants
+    std::vector<int> levels;
+    for (int p = 0; p < num_players_; ++p) {
+        if (!has_folded_[p] && contributions_[p] > 0) levels.push_back(contributions_[p]);
+    }
+    std::sort(levels.begin(), levels.end());
+    levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+
+    std::vector<SidePot> pots;
+    int previous_level = 0;
+    for (size_t l = 0; l < levels.size(); ++l) {
+        // Le dernier niveau absorbe les mises de joueurs couchés qui le dépasseraient
+        const int level = l + 1 == levels.size() ? std::numeric_limits<int>::max() : levels[l];
+        SidePot pot;
+        for (int p = 0; p < num_players_; ++p) {
+            pot.amount += std::max(0, std::min(contributions_[p], level) - previous_level);
+            if (!has_folded_[p] && contributions_[p] >= levels[l]) pot.eligible_players.push_back(p);
+        }
+        previous_level = level;
+        pots.push_back(std::move(pot));
+    }
+    return pots;
+}
 
 int GameState::get_num_active_players() const {
     int cnt = 0;
@@ -136,7 +188,7 @@ int GameState::get_num_active_players() const {
 //  Implémentation de progress_to_next_street (basée sur l'ancienne end_betting_round)
 // -----------------------------------------------------------------------------
 void GameState::progress_to_next_street() {
-    spdlog::debug("Progressing to next street from {}", street_to_string(current_street_));
+    SPDLOG_DEBUG("Progressing to next street from {}", street_to_string(current_street_));
     Street next_street = current_street_;
     if (current_street_ == Street::PREFLOP)    next_street = Street::FLOP;
     else if (current_street_ == Street::FLOP)  next_street = Street::TURN;
@@ -145,31 +197,37 @@ void GameState::progress_to_next_street() {
     else { /* Déjà Showdown ou état invalide */ return; }
 
     current_street_ = next_street;
-    spdlog::debug("Moved to street {}", street_to_string(current_street_));
+    SPDLOG_DEBUG("Moved to street {}", street_to_string(current_street_));
 
     if (current_street_ == Street::SHOWDOWN) {
-        spdlog::info("Hand reached Showdown");
+        SPDLOG_DEBUG("Hand reached Showdown");
         current_player_index_ = -1; 
         last_aggressor_index_ = -1; // Réinitialiser aussi ici
         return;
     }
 
     // Deal board cards
-    if (current_street_ == Street::FLOP && board_cards_dealt_ == 0) {
+    if (explicit_chance_) {
+        // Cartes fournies ensuite par deal_board_card (nœud de hasard)
+        if (current_street_ == Street::FLOP && board_cards_dealt_ == 0) pending_board_cards_ = 3;
+        else if (current_street_ == Street::TURN && board_cards_dealt_ == 3) pending_board_cards_ = 1;
+        else if (current_street_ == Street::RIVER && board_cards_dealt_ == 4) pending_board_cards_ = 1;
+    } else if (current_street_ == Street::FLOP && board_cards_dealt_ == 0) {
         deck_.burn_card(); board_[0] = deck_.deal_card(); board_[1] = deck_.deal_card(); board_[2] = deck_.deal_card(); board_cards_dealt_ = 3;
-        spdlog::debug("FLOP: [{} {} {}]", to_string(board_[0]), to_string(board_[1]), to_string(board_[2]));
+        SPDLOG_DEBUG("FLOP: [{} {} {}]", to_string(board_[0]), to_string(board_[1]), to_string(board_[2]));
     } else if (current_street_ == Street::TURN && board_cards_dealt_ == 3) {
         deck_.burn_card(); board_[3] = deck_.deal_card(); board_cards_dealt_ = 4;
-        spdlog::debug("TURN: {}", to_string(board_[3]));
+        SPDLOG_DEBUG("TURN: {}", to_string(board_[3]));
     } else if (current_street_ == Street::RIVER && board_cards_dealt_ == 4) {
         deck_.burn_card(); board_[4] = deck_.deal_card(); board_cards_dealt_ = 5;
-        spdlog::debug("RIVER: {}", to_string(board_[4]));
+        SPDLOG_DEBUG("RIVER: {}", to_string(board_[4]));
     }
 
     // Reset for next street
     std::fill(current_bets_.begin(), current_bets_.end(), 0);
     last_raise_size_ = big_blind_size_; // Réinitialiser à la taille de la BB pour la nouvelle street
     last_aggressor_index_ = -1; // Pas d'agresseur au début d'une nouvelle street
+    street_raise_count_ = 0;
 
     // Find first player to act
     current_player_index_ = (button_pos_ + 1) % num_players_; // Postflop commence après bouton
@@ -178,12 +236,12 @@ void GameState::progress_to_next_street() {
         current_player_index_ = (current_player_index_ + 1) % num_players_;
         players_checked++;
         if (players_checked > num_players_) { 
-            spdlog::debug("No active player found?");
+            SPDLOG_DEBUG("No active player found?");
             current_player_index_ = -1; 
             return; 
         }
     }
-    spdlog::debug("New street {}, first player: {}", street_to_string(current_street_), current_player_index_);
+    SPDLOG_DEBUG("New street {}, first player: {}", street_to_string(current_street_), current_player_index_);
 }
 
 // -----------------------------------------------------------------------------
@@ -199,9 +257,10 @@ void GameState::end_betting_round()
         }
     }
     if (active_non_folded_count <= 1) {
-        spdlog::debug("EndBettingRound: <=1 active non-foldé player, proceeding to showdown.");
+        SPDLOG_DEBUG("EndBettingRound: <=1 active non-foldé player, proceeding to showdown.");
         if (current_street_ != Street::SHOWDOWN) progress_to_next_street();
         current_player_index_ = -1; 
+        pending_board_cards_ = 0; // Main gagnée sans showdown : pas de board à dérouler
         return;
     }
 
@@ -219,9 +278,14 @@ void GameState::end_betting_round()
     }
 
     if (all_remaining_active_are_all_in) {
-        spdlog::debug("EndBettingRound: Tous les joueurs actifs non-foldés sont all-in. Progression vers la street suivante/showdown.");
+        SPDLOG_DEBUG("EndBettingRound: Tous les joueurs actifs non-foldés sont all-in. Progression vers la street suivante/showdown.");
         if (current_street_ != Street::SHOWDOWN) progress_to_next_street();
         current_player_index_ = -1; // Indiquer fin de l'action pour cette main/street
+        if (explicit_chance_ && current_street_ != Street::SHOWDOWN) {
+            // Board déroulé carte par carte jusqu'au showdown
+            pending_board_cards_ = 5 - board_cards_dealt_;
+            runout_to_showdown_ = pending_board_cards_ > 0;
+        }
         return;
     }
     // Si on arrive ici, il y a au moins un joueur actif non-foldé avec du stack pour potentiellement agir.
@@ -274,13 +338,13 @@ void GameState::end_betting_round()
              // Si le prochain joueur à parler est celui qui ferme l'action initiale
             if (player_to_act_next == closing_player) {
                 action_closed = true;
-                spdlog::trace("Action closed: No raise, action returned to initial actor {}.", closing_player);
+                SPDLOG_TRACE("Action closed: No raise, action returned to initial actor {}.", closing_player);
             }
         } else { // Une relance a eu lieu
             // Si le prochain joueur à parler est le dernier relanceur
             if (player_to_act_next == last_aggressor_index_) {
                 action_closed = true;
-                spdlog::trace("Action closed: Action returned to last aggressor {}.", last_aggressor_index_);
+                SPDLOG_TRACE("Action closed: Action returned to last aggressor {}.", last_aggressor_index_);
             }
         }
         
@@ -288,18 +352,18 @@ void GameState::end_betting_round()
         // alors must_continue doit être vrai.
         if (!action_closed) {
              must_continue = true;
-             spdlog::trace("Action not closed yet, betting continues.");
+             SPDLOG_TRACE("Action not closed yet, betting continues.");
         }
     }
 
     // 4) Décision finale
     if (!must_continue && action_closed) { 
-        spdlog::debug("EndBettingRound: Action closed and bets matched. Progressing street.");
+        SPDLOG_DEBUG("EndBettingRound: Action closed and bets matched. Progressing street.");
         progress_to_next_street();
     } else {
         // Le tour continue. Mettre à jour le joueur courant vers celui trouvé.
         current_player_index_ = player_to_act_next;
-        spdlog::trace("Betting round continues, next player: {}.", current_player_index_);
+        SPDLOG_TRACE("Betting round continues, next player: {}.", current_player_index_);
         return;
     }
 }
@@ -311,6 +375,7 @@ void GameState::apply_action(const Action& action)
 {
     int acting_player = current_player_index_; // Sauvegarder qui agit
     if (acting_player < 0) { spdlog::warn("Action on ended game."); return; }
+    if (pending_board_cards_ > 0) throw std::logic_error("Action on chance node (board cards pending)");
     if (action.player_index != acting_player) throw std::logic_error("Wrong player action");
     if (has_folded_[acting_player]) throw std::logic_error("Folded player action");
 
@@ -322,18 +387,19 @@ void GameState::apply_action(const Action& action)
     switch (action.type) {
         case gto_solver::ActionType::FOLD: {
             has_folded_[acting_player] = true;
-            spdlog::info("P{} FOLD", acting_player); break;
+            SPDLOG_DEBUG("P{} FOLD", acting_player); break;
         }
         case gto_solver::ActionType::CALL: {
-            if (amount_to_call == 0) { spdlog::info("P{} CHECK", acting_player); }
+            if (amount_to_call == 0) { SPDLOG_DEBUG("P{} CHECK", acting_player); }
             else {
                 const int call_amt = std::min(player_stack, amount_to_call);
                 if (call_amt <= 0) { spdlog::warn("P{} tente CALL 0 -> CHECK?", acting_player); }
                 else {
                     stacks_[acting_player] -= call_amt;
                     current_bets_[acting_player] += call_amt;
+                    contributions_[acting_player] += call_amt;
                     pot_size_ += call_amt;
-                    spdlog::info("P{} CALL {} (stack {})", acting_player, call_amt, stacks_[acting_player]);
+                    SPDLOG_DEBUG("P{} CALL {} (stack {})", acting_player, call_amt, stacks_[acting_player]);
                 }
             } break;
         }
@@ -348,10 +414,12 @@ void GameState::apply_action(const Action& action)
             if (!is_all_in && raise_size < last_raise_size_ && max_bet > 0) throw std::logic_error("Raise < min-raise");
             stacks_[acting_player] -= raise_added;
             current_bets_[acting_player] = total_bet_after_raise;
+            contributions_[acting_player] += raise_added;
             pot_size_ += raise_added;
             if (!is_all_in || raise_size >= last_raise_size_) { last_raise_size_ = raise_size; }
-            spdlog::info("P{} RAISE to {} (+{}, inc {}, stack {})", acting_player, total_bet_after_raise, raise_added, raise_size, stacks_[acting_player]);
+            SPDLOG_DEBUG("P{} RAISE to {} (+{}, inc {}, stack {})", acting_player, total_bet_after_raise, raise_added, raise_size, stacks_[acting_player]);
             last_aggressor_index_ = acting_player;
+            street_raise_count_++;
             break;
         }
         default: throw std::logic_error("Type action inconnu");
@@ -369,6 +437,10 @@ std::vector<Action> GameState::get_legal_abstract_actions(const ActionAbstractio
     return abstraction.get_abstract_actions(*this);
 }
 
+void GameState::get_legal_abstract_actions(const ActionAbstraction& abstraction, std::vector<Action>& actions) const {
+    abstraction.get_abstract_actions(*this, actions);
+}
+
 // -----------------------------------------------------------------------------
 //  Fonctions Helper Privées
 // -----------------------------------------------------------------------------
@@ -395,7 +467,7 @@ bool GameState::is_betting_round_over() const {
         // TODO: Logique plus fine pour fermeture action
         bool bb_option_closed = (current_street_ == Street::PREFLOP && max_bet == BB_SIZE && current_player_index_ == (button_pos_ + 1) % num_players_);
         if (max_bet > 0 || bb_option_closed) {
-            spdlog::trace("Betting round over (simplified check)"); return true;
+            SPDLOG_TRACE("Betting round over (simplified check)"); return true;
         }
     }
     return false;
@@ -435,33 +507,67 @@ void GameState::print_state() const {
     spdlog::info("\n{}", toString());
 }
 
-// Implémentation de get_remaining_deck_cards
-std::vector<Card> GameState::get_remaining_deck_cards() const {
-    std::vector<bool> is_card_available(NUM_CARDS, true);
+void GameState::set_explicit_chance_nodes(bool enabled) {
+    if (pending_board_cards_ > 0) {
+        throw std::logic_error("set_explicit_chance_nodes: nœud de hasard en cours");
+    }
+    explicit_chance_ = enabled;
+}
 
-    // Marquer les cartes des joueurs comme non disponibles
-    for (const auto& hand : player_hands_) {
-        for (Card card_in_hand : hand) {
-            if (card_in_hand != INVALID_CARD && card_in_hand < NUM_CARDS) {
-                is_card_available[card_in_hand] = false;
-            }
-        }
+void GameState::deal_board_card(Card card) {
+    if (pending_board_cards_ <= 0) throw std::logic_error("deal_board_card: pas un nœud de hasard");
+    if (card >= NUM_CARDS || !test_card(get_remaining_deck_mask(), card)) {
+        throw std::invalid_argument("deal_board_card: carte invalide ou déjà visible");
+    }
+    board_[board_cards_dealt_++] = card;
+    pending_board_cards_--;
+    if (pending_board_cards_ == 0 && runout_to_showdown_) {
+        // Toutes les cartes ont été déroulées après un all-in
+        current_street_ = Street::SHOWDOWN;
+        runout_to_showdown_ = false;
     }
+}
 
-    // Marquer les cartes du board comme non disponibles
-    for (int i = 0; i < board_cards_dealt_; ++i) {
-        if (board_[i] != INVALID_CARD && board_[i] < NUM_CARDS) {
-            is_card_available[board_[i]] = false;
-        }
+bool GameState::is_terminal() const {
+    return pending_board_cards_ == 0 && (current_player_index_ < 0 || current_street_ == Street::SHOWDOWN);
+}
+
+Bitboard GameState::get_remaining_deck_mask() const {
+    Bitboard dead = EMPTY_BOARD;
+    for (const auto& hand : player_hands_) {
+        for (Card card_in_hand : hand) set_card(dead, card_in_hand);
     }
+    for (int i = 0; i < board_cards_dealt_; ++i) set_card(dead, board_[i]);
+    return FULL_DECK & ~dead;
+}
 
-    std::vector<Card> remaining_cards;
-    for (Card c = 0; c < NUM_CARDS; ++c) {
-        if (is_card_available[c]) {
-            remaining_cards.push_back(c);
-        }
+uint64_t GameState::public_state_hash() const {
+    uint64_t h = splitmix64(static_cast<uint64_t>(num_players_));
+    auto mix = [&h](int64_t value) { h = splitmix64(h ^ static_cast<uint64_t>(value)); };
+    mix(static_cast<int64_t>(current_street_));
+    mix(current_player_index_);
+    mix(pot_size_);
+    mix(last_raise_size_);
+    mix(last_aggressor_index_);
+    mix(street_raise_count_);
+    mix(button_pos_);
+    mix(big_blind_size_);
+    mix(pending_board_cards_);
+    mix(runout_to_showdown_);
+    for (int p = 0; p < num_players_; ++p) {
+        mix(stacks_[p]);
+        mix(current_bets_[p]);
+        mix(contributions_[p]);
+        mix(has_folded_[p]);
     }
-    return remaining_cards;
+    Bitboard board_mask = EMPTY_BOARD; // Ordre de distribution ignoré
+    for (int i = 0; i < board_cards_dealt_; ++i) set_card(board_mask, board_[i]);
+    mix(static_cast<int64_t>(board_mask));
+    return h;
+}
+
+std::vector<Card> GameState::get_remaining_deck_cards() const {
+    return board_to_cards(get_remaining_deck_mask());
 }
 
 int GameState::get_big_blind_size() const {
@@ -0,0 +1,193 @@
+#include "gto/hand_range.h"
+#include "eval/hand_evaluator.hpp" // Pour INVALID_HAND_RANK
+#include <algorithm>
+#include <stdexcept>
+
+namespace gto_solver {
+
+namespace {
+
+std::array<HoleCombo, NUM_HOLE_COMBOS> build_combos() {
+    std::array<HoleCombo, NUM_HOLE_COMBOS> combos{};
+    int idx = 0;
+    for (int a = 0; a < NUM_CARDS; ++a) {
+        for (int b = a + 1; b < NUM_CARDS; ++b) {
+            combos[idx++] = {static_cast<Card>(a), static_cast<Card>(b)};
+        }
+    }
+    return combos;
+}
+
+std::array<std::array<int16_t, NUM_CARDS>, NUM_CARDS> build_index_table() {
+    std::array<std::array<int16_t, NUM_CARDS>, NUM_CARDS> table{};
+    for (auto& row : table) row.fill(-1);
+    const auto& combos = all_hole_combos();
+    for (int i = 0; i < NUM_HOLE_COMBOS; ++i) {
+        table[combos[i].c1][combos[i].c2] = static_cast<int16_t>(i);
+        table[combos[i].c2][combos[i].c1] = static_cast<int16_t>(i);
+    }
+    return table;
+}
+
+} // namespace
+
+const std::array<HoleCombo, NUM_HOLE_COMBOS>& all_hole_combos() {
+    static const std::array<HoleCombo, NUM_HOLE_COMBOS> combos = build_combos();
+    return combos;
+}
+
+int combo_index(Card a, Card b) {
+    static const auto table = build_index_table();
+    if (a >= NUM_CARDS || b >= NUM_CARDS) return -1;
+    return table[a][b];
+}
+
+const std::array<std::string, NUM_HOLE_COMBOS>& hole_combo_strings() {
+    static const std::array<std::string, NUM_HOLE_COMBOS> strings = [] {
+        std::array<std::string, NUM_HOLE_COMBOS> out;
+        const auto& combos = all_hole_combos();
+        for (int i = 0; i < NUM_HOLE_COMBOS; ++i) out[i] = to_string(combos[i].c1) + "-" + to_string(combos[i].c2);
+        return out;
+    }();
+    return strings;
+}
+
+RangeVector make_uniform_range(Bitboard dead_cards) {
+    RangeVector range(NUM_HOLE_COMBOS, 1.0);
+    remove_blocked_combos(range, dead_cards);
+    return range;
+}
+
+void remove_blocked_combos(RangeVector& range, Bitboard dead_cards) {
+    if (range.size() != NUM_HOLE_COMBOS) {
+        throw std::invalid_argument("remove_blocked_combos: range de taille invalide");
+    }
+    if (dead_cards == EMPTY_BOARD) return;
+    const auto& combos = all_hole_combos();
+    for (int i = 0; i < NUM_HOLE_COMBOS; ++i) {
+        if (combos[i].mask() & dead_cards) range[i] = 0.0;
+    }
+}
+
+void fold_values(const RangeVector& opp_reach, double payoff, RangeVector& out) {
+    out.resize(NUM_HOLE_COMBOS);
+    fold_values(std::span<const double>(opp_reach), payoff, std::span<double>(out));
+}
+
+void fold_values(std::span<const double> opp_reach, double payoff, std::span<double> out) {
+    const auto& combos = all_hole_combos();
+    // Somme des poids adverses contenant chaque carte
+    std::array<double, NUM_CARDS> card_sums{};
+    double total = 0.0;
+    for (int i = 0; i < NUM_HOLE_COMBOS; ++i) {
+        const double w = opp_reach[i];
+        if (w == 0.0) continue;
+        total += w;
+        card_sums[combos[i].c1] += w;
+        card_sums[combos[i].c2] += w;
+    }
+
+    for (int i = 0; i < NUM_HOLE_COMBOS; ++i) {
+        // Le combo identique est retiré deux fois (une par carte) : on le rajoute une fois.
+        const double compatible = total - card_sums[combos[i].c1] - card_sums[combos[i].c2] + opp_reach[i];
+        out[i] = payoff * compatible;
+    }
+}
+
+std::vector<int> sort_combos_by_strength(const std::vector<uint16_t>& hand_ranks) {
+    std::vector<int> sorted;
+    sorted.reserve(NUM_HOLE_COMBOS);
+    for (int i = 0; i < NUM_HOLE_COMBOS; ++i) {
+        if (hand_ranks[i] != INVALID_HAND_RANK) sorted.push_back(i);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [&](int a, int b) { return hand_ranks[a] < hand_ranks[b]; });
+    return sorted;
+}
+
+void showdown_values(const RangeVector& opp_reach,
+                     const std::vector<uint16_t>& hand_ranks,
+                     const std::vector<int>& sorted_combos,
+                     double stake,
+                     RangeVector& out) {
+    out.resize(NUM_HOLE_COMBOS);
+    showdown_values(std::span<const double>(opp_reach), hand_ranks, sorted_combos, stake, std::span<double>(out));
+}
+
+void showdown_values(std::span<const double> opp_reach,
+                     const std::vector<uint16_t>& hand_ranks,
+                     const std::vector<int>& sorted_combos,
+                     double stake,
+                     std::span<double> out) {
+    const auto& combos = all_hole_combos();
+    std::fill(out.begin(), out.end(), 0.0);
+    const size_t n = sorted_combos.size();
+
+    // Passe 1 (du plus faible au plus fort) : poids adverses strictement plus faibles.
+    // Les égalités sont traitées par groupe : on évalue tout le groupe avant de l'accumuler.
+    {
+        std::array<double, NUM_CARDS> card_sums{};
+        double total = 0.0;
+        size_t group_end = n; // Groupe courant : [group_begin, group_end)
+        while (group_end > 0) {
+            size_t group_begin = group_end - 1;
+            const uint16_t rank = hand_ranks[sorted_combos[group_begin]];
+            while (group_begin > 0 && hand_ranks[sorted_combos[group_begin - 1]] == rank) --group_begin;
+
+            for (size_t k = group_begin; k < group_end; ++k) {
+                const int h = sorted_combos[k];
+                out[h] += stake * (total - card_sums[combos[h].c1] - card_sums[combos[h].c2]);
+            }
+            for (size_t k = group_begin; k < group_end; ++k) {
+                const int h = sorted_combos[k];
+                total += opp_reach[h];
+                card_sums[combos[h].c1] += opp_reach[h];
+                card_sums[combos[h].c2] += opp_reach[h];
+            }
+            group_end = group_begin;
+        }
+    }
+
+    // Passe 2 (du plus fort au plus faible) : poids adverses strictement plus forts.
+    {
+        std::array<double, NUM_CARDS> card_sums{};
+        double total = 0.0;
+        size_t group_begin = 0;
+        while (group_begin < n) {
+            size_t group_end = group_begin + 1;
+            const uint16_t rank = hand_ranks[sorted_combos[group_begin]];
+            while (group_end < n && hand_ranks[sorted_combos[group_end]] == rank) ++group_end;
+
+            for (size_t k = group_begin; k < group_end; ++k) {
+                const int h = sorted_combos[k];
+                out[h] -= stake * (total - card_sums[combos[h].c1] - card_sums[combos[h].c2]);
+            }
+            for (size_t k = group_begin; k < group_end; ++k) {
+                const int h = sorted_combos[k];
+                total += opp_reach[h];
+                card_sums[combos[h].c1] += opp_reach[h];
+                card_sums[combos[h].c2] += opp_reach[h];
+            }
+            group_begin = group_end;
+        }
+    }
+}
+
+BoardRanking rank_hole_combos(const std::array<Card, 5>& board) {
+    BoardRanking ranking;
+    ranking.board = board;
+    for (Card c : board) set_card(ranking.board_mask, c);
+
+    const std::vector<Card> board_vec(board.begin(), board.end());
+    const auto& combos = all_hole_combos();
+    ranking.hand_ranks.assign(NUM_HOLE_COMBOS, INVALID_HAND_RANK);
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (combos[h].mask() & ranking.board_mask) continue;
+        ranking.hand_ranks[h] = evaluate_hand_7_card(combos[h].c1, combos[h].c2, board_vec);
+        ranking.valid_combos++;
+    }
+    ranking.sorted_combos = sort_combos_by_strength(ranking.hand_ranks);
+    return ranking;
+}
+
+} // namespace gto_solver
@@ -5,44 +5,315 @@
 #include <numeric>   // Pour std::accumulate, std::iota
 #include <iomanip>   // Pour std::setprecision, std::fixed
 #include <sstream>
+#include <cmath>     // Pour std::round
+#include <cstring>   // Pour std::memcpy
+#include <limits>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
 
 namespace gto_solver {
 
-void InformationSet::initialize(size_t num_actions) {
+namespace {
+
+// Bornes au-delà desquelles les sommes de stratégie sont divisées par 2.
+constexpr double FLOAT16_STRATEGY_LIMIT = 60000.0; // max fini float16 : 65504
+constexpr double FLOAT32_STRATEGY_LIMIT = 1e37;
+constexpr double INT32_REGRET_MAX = static_cast<double>(std::numeric_limits<int32_t>::max());
+constexpr double INT32_REGRET_MIN = static_cast<double>(std::numeric_limits<int32_t>::min());
+
+// Conversion IEEE 754 binary32 -> binary16, arrondi au plus proche (pair).
+uint16_t float_to_half(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t raw_exponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (raw_exponent == 0xFFu) { // Inf / NaN
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    }
+    const int exponent = static_cast<int>(raw_exponent) - 127 + 15;
+    if (exponent >= 31) { // Trop grand -> infini
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (exponent <= 0) { // Sous-normal ou zéro
+        if (exponent < -10) return static_cast<uint16_t>(sign);
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half_mantissa = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half_mantissa & 1u))) half_mantissa++;
+        return static_cast<uint16_t>(sign | half_mantissa);
+    }
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) half++; // La retenue passe dans l'exposant
+    return static_cast<uint16_t>(half);
+}
+
+float half_to_float(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1Fu;
+    uint32_t mantissa = half & 0x3FFu;
+    uint32_t bits;
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        } else { // Sous-normal : normaliser
+            exponent = 127 - 15 + 1;
+            while (!(mantissa & 0x400u)) { mantissa <<= 1; exponent--; }
+            mantissa &= 0x3FFu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template <typename T>
+T load_as(const uint8_t* ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void store_as(uint8_t* ptr, T value) {
+    std::memcpy(ptr, &value, sizeof(T));
+}
+
+// Choisit entre deux valeurs représentables encadrant `target`, avec une probabilité
+// proportionnelle à la proximité : l'accumulation reste non biaisée même quand
+// l'incrément est inférieur à l'ULP (sinon une somme float16 stagne vers ~2048).
+bool round_up_stochastically(double target, double lower, double upper, Rng& rng) {
+    if (upper <= lower) return false;
+    return rng.uniform_real() < (target - lower) / (upper - lower);
+}
+
+int32_t saturate_to_int32(double scaled) {
+    return static_cast<int32_t>(std::clamp(std::round(scaled), INT32_REGRET_MIN, INT32_REGRET_MAX));
+}
+
+// Table des descripteurs de précision référencés par InformationSet::precision_id_.
+// Les entrées [0, precision_count) ne changent plus une fois publiées : lecture sans verrou.
+constexpr size_t MAX_STORAGE_PRECISIONS = 256;
+std::array<StoragePrecision, MAX_STORAGE_PRECISIONS> precision_table{}; // [0] : précision par défaut
+std::atomic<size_t> precision_count{1};
+std::mutex precision_mutex;
+
+uint8_t intern_precision(const StoragePrecision& precision) {
+    size_t count = precision_count.load(std::memory_order_acquire);
+    for (size_t id = 0; id < count; ++id) {
+        if (precision_table[id] == precision) return static_cast<uint8_t>(id);
+    }
+    std::lock_guard<std::mutex> lock(precision_mutex);
+    count = precision_count.load(std::memory_order_relaxed);
+    for (size_t id = 0; id < count; ++id) {
+        if (precision_table[id] == precision) return static_cast<uint8_t>(id);
+    }
+    if (count == MAX_STORAGE_PRECISIONS) {
+        throw std::length_error("InformationSet: trop de précisions de stockage distinctes");
+    }
+    precision_table[count] = precision;
+    precision_count.store(count + 1, std::memory_order_release);
+    return static_cast<uint8_t>(count);
+}
+
+} // namespace
+
+const StoragePrecision& InformationSet::precision() const {
+    return precision_table[precision_id_];
+}
+
+uint8_t* InformationSet::regret_ptr(size_t i) {
+    return data_.data() + i * precision().regret_bytes();
+}
+
+const uint8_t* InformationSet::regret_ptr(size_t i) const {
+    return data_.data() + i * precision().regret_bytes();
+}
+
+uint8_t* InformationSet::strategy_ptr(size_t i) {
+    const StoragePrecision& p = precision();
+    return data_.data() + num_actions_ * p.regret_bytes() + i * p.strategy_bytes();
+}
+
+const uint8_t* InformationSet::strategy_ptr(size_t i) const {
+    const StoragePrecision& p = precision();
+    return data_.data() + num_actions_ * p.regret_bytes() + i * p.strategy_bytes();
+}
+
+void InformationSet::initialize(size_t num_actions, const StoragePrecision& precision) {
     if (num_actions == 0) {
         // Peut arriver pour un nœud terminal ou si aucune action n'est légale (rare)
         // spdlog ici si on en ajoute un logger
         return;
     }
-    cumulative_regrets.assign(num_actions, 0.0);
-    cumulative_strategy.assign(num_actions, 0.0);
+    precision_id_ = intern_precision(precision);
+    num_actions_ = static_cast<uint32_t>(num_actions);
+    data_.assign(num_actions * precision.bytes_per_action(), 0); // 0 binaire == 0.0 pour tous les formats
     visit_count = 0;
+    dirty = true; // Nouvel infoset : doit apparaître dans le prochain checkpoint delta
+}
+
+double InformationSet::get_regret(size_t i) const {
+    if (precision().regrets == RegretStorage::INT32_SCALED) {
+        return static_cast<double>(load_as<int32_t>(regret_ptr(i))) / precision().regret_scale;
+    }
+    return load_as<double>(regret_ptr(i));
+}
+
+void InformationSet::set_regret(size_t i, double value) {
+    if (precision().regrets == RegretStorage::INT32_SCALED) {
+        store_as<int32_t>(regret_ptr(i), saturate_to_int32(value * precision().regret_scale));
+    } else {
+        store_as<double>(regret_ptr(i), value);
+    }
+}
+
+bool InformationSet::add_regret(size_t i, double delta) {
+    const StoragePrecision& p = precision();
+    if (p.regrets == RegretStorage::INT32_SCALED) {
+        double scaled_delta = delta * p.regret_scale;
+        double updated = load_as<int32_t>(regret_ptr(i)) + std::round(scaled_delta);
+        bool rescaled = false;
+        while (updated > INT32_REGRET_MAX) {
+            // Dépassement positif : diviser tout l'infoset par 2, incrément compris, donne
+            // exactement la stratégie courante qu'aurait eue le stockage double.
+            rescale_regrets(0.5);
+            scaled_delta *= 0.5;
+            updated = load_as<int32_t>(regret_ptr(i)) + std::round(scaled_delta);
+            rescaled = true;
+        }
+        // Les regrets très négatifs saturent au plancher (pas de rescale : ils jouent 0 de toute façon).
+        store_as<int32_t>(regret_ptr(i), saturate_to_int32(updated));
+        return rescaled;
+    }
+    store_as<double>(regret_ptr(i), load_as<double>(regret_ptr(i)) + delta);
+    return false;
+}
+
+void InformationSet::rescale_regrets(double factor) {
+    for (size_t i = 0; i < num_actions_; ++i) {
+        if (precision().regrets == RegretStorage::INT32_SCALED) {
+            store_as<int32_t>(regret_ptr(i), saturate_to_int32(load_as<int32_t>(regret_ptr(i)) * factor));
+        } else {
+            store_as<double>(regret_ptr(i), load_as<double>(regret_ptr(i)) * factor);
+        }
+    }
+}
+
+double InformationSet::get_strategy_sum(size_t i) const {
+    switch (precision().strategy) {
+        case StrategyStorage::FLOAT32: return load_as<float>(strategy_ptr(i));
+        case StrategyStorage::FLOAT16: return half_to_float(load_as<uint16_t>(strategy_ptr(i)));
+        case StrategyStorage::DOUBLE:  break;
+    }
+    return load_as<double>(strategy_ptr(i));
+}
+
+void InformationSet::set_strategy_sum(size_t i, double value) {
+    switch (precision().strategy) {
+        case StrategyStorage::FLOAT32:
+            store_as<float>(strategy_ptr(i), static_cast<float>(std::min(value, FLOAT32_STRATEGY_LIMIT)));
+            return;
+        case StrategyStorage::FLOAT16:
+            store_as<uint16_t>(strategy_ptr(i), float_to_half(static_cast<float>(std::min(value, FLOAT16_STRATEGY_LIMIT))));
+            return;
+        case StrategyStorage::DOUBLE:
+            break;
+    }
+    store_as<double>(strategy_ptr(i), value);
+}
+
+void InformationSet::add_strategy_sum(size_t i, double delta, Rng& rng) {
+    double updated = get_strategy_sum(i) + delta;
+    const double limit = precision().strategy == StrategyStorage::FLOAT16 ? FLOAT16_STRATEGY_LIMIT
+                       : precision().strategy == StrategyStorage::FLOAT32 ? FLOAT32_STRATEGY_LIMIT
+                       : std::numeric_limits<double>::infinity();
+    if (updated > limit) {
+        // La stratégie moyenne est normalisée : diviser toutes les sommes par 2 ne la change pas.
+        rescale_strategy_sums(0.5);
+        updated = get_strategy_sum(i) + delta;
+    }
+
+    switch (precision().strategy) {
+        case StrategyStorage::FLOAT32: {
+            float stored = static_cast<float>(updated);
+            if (static_cast<double>(stored) != updated) {
+                const float other = std::nextafter(stored, updated > stored ? std::numeric_limits<float>::infinity()
+                                                                            : -std::numeric_limits<float>::infinity());
+                const float lower = std::min(stored, other);
+                const float upper = std::max(stored, other);
+                stored = round_up_stochastically(updated, lower, upper, rng) ? upper : lower;
+            }
+            store_as<float>(strategy_ptr(i), stored);
+            return;
+        }
+        case StrategyStorage::FLOAT16: {
+            uint16_t stored = float_to_half(static_cast<float>(updated));
+            const double nearest = half_to_float(stored);
+            if (updated > 0.0 && nearest != updated) {
+                // Valeurs positives : le motif binaire suivant est la valeur représentable suivante.
+                const uint16_t other = updated > nearest ? static_cast<uint16_t>(stored + 1) : static_cast<uint16_t>(stored - 1);
+                const bool other_is_upper = updated > nearest;
+                const double lower = other_is_upper ? nearest : half_to_float(other);
+                const double upper = other_is_upper ? half_to_float(other) : nearest;
+                const bool pick_upper = round_up_stochastically(updated, lower, upper, rng);
+                stored = (pick_upper == other_is_upper) ? other : stored;
+            }
+            store_as<uint16_t>(strategy_ptr(i), stored);
+            return;
+        }
+        case StrategyStorage::DOUBLE:
+            break;
+    }
+    store_as<double>(strategy_ptr(i), updated);
+}
+
+void InformationSet::rescale_strategy_sums(double factor) {
+    for (size_t i = 0; i < num_actions_; ++i) {
+        set_strategy_sum(i, get_strategy_sum(i) * factor);
+    }
 }
 
 std::vector<double> InformationSet::get_current_strategy() const {
-    std::vector<double> strategy(cumulative_regrets.size());
+    std::vector<double> strategy(num_actions_);
+    get_current_strategy(strategy);
+    return strategy;
+}
+
+void InformationSet::get_current_strategy(std::span<double> strategy) const {
     double sum_positive_regrets = 0.0;
 
-    for (double regret : cumulative_regrets) {
-        sum_positive_regrets += std::max(0.0, regret);
+    for (size_t i = 0; i < num_actions_; ++i) {
+        strategy[i] = std::max(0.0, get_regret(i));
+        sum_positive_regrets += strategy[i];
     }
 
     if (sum_positive_regrets > 0.0) {
-        for (size_t i = 0; i < cumulative_regrets.size(); ++i) {
-            strategy[i] = std::max(0.0, cumulative_regrets[i]) / sum_positive_regrets;
+        for (double& prob : strategy) {
+            prob /= sum_positive_regrets;
         }
     } else {
         // Si tous les regrets sont nuls ou négatifs, jouer uniformément.
         // Cela arrive souvent au début ou si une action domine largement les autres.
-        double uniform_prob = (cumulative_regrets.empty()) ? 0.0 : (1.0 / cumulative_regrets.size());
+        double uniform_prob = (num_actions_ == 0) ? 0.0 : (1.0 / num_actions_);
         std::fill(strategy.begin(), strategy.end(), uniform_prob);
     }
-    return strategy;
 }
 
 // node_value est la EV de l'état courant (infoset) si on suit la stratégie actuelle.
-void InformationSet::update_regrets(const std::vector<double>& action_values, double node_value) {
-    if (action_values.size() != cumulative_regrets.size()) {
+void InformationSet::update_regrets(std::span<const double> action_values, double node_value) {
+    if (action_values.size() != num_actions_) {
         // Gérer l'erreur : tailles incohérentes. Peut-être lancer une exception.
         // Ou logguer une erreur sévère.
         // Pour l'instant, on suppose que les tailles correspondent.
@@ -51,19 +322,21 @@ void InformationSet::update_regrets(const std::vector<double>& action_values, do
     }
 
     for (size_t i = 0; i < action_values.size(); ++i) {
-        cumulative_regrets[i] += (action_values[i] - node_value);
+        add_regret(i, action_values[i] - node_value);
     }
+    dirty = true;
 }
 
-void InformationSet::update_strategy_sum(const std::vector<double>& current_strategy_profile) {
-    if (current_strategy_profile.size() != cumulative_strategy.size()) {
+void InformationSet::update_strategy_sum(std::span<const double> current_strategy_profile, Rng& rng) {
+    if (current_strategy_profile.size() != num_actions_) {
         // Gérer l'erreur
         return;
     }
     for (size_t i = 0; i < current_strategy_profile.size(); ++i) {
-        cumulative_strategy[i] += current_strategy_profile[i];
+        add_strategy_sum(i, current_strategy_profile[i], rng);
     }
     visit_count++; // On pourrait aussi passer player_reach_prob et l'ajouter ici.
+    dirty = true;
 }
 
 // Génération de la clé d'infoset
@@ -124,5 +397,19 @@ std::string InformationSet::generate_key(
     return ss.str();
 }
 
+std::string InformationSet::generate_transposition_key(
+    int player_index,
+    const std::vector<Card>& hole_cards,
+    const std::array<Card, 5>& board,
+    int board_cards_dealt,
+    Street current_street,
+    uint64_t public_state_hash
+) {
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    std::string key = generate_key(player_index, hole_cards, board, board_cards_dealt, current_street, {});
+    key.push_back('#');
+    for (int shift = 60; shift >= 0; shift -= 4) key.push_back(HEX_DIGITS[(public_state_hash >> shift) & 0xF]);
+    return key;
+}
 
-} // namespace gto_solver 
\ No newline at end of file
+} // namespace gto_solver
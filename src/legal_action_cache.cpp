@@ -0,0 +1,74 @@
+#include "gto/legal_action_cache.h"
+#include "gto/game_state.h"
+#include "core/rng.hpp" // Pour splitmix64
+#include <algorithm>
+#include <mutex>
+
+namespace gto_solver {
+
+PublicBettingKey PublicBettingKey::from_state(const GameState& state) {
+    PublicBettingKey key;
+    key.street = static_cast<int8_t>(state.get_current_street());
+    key.player = static_cast<int8_t>(state.get_current_player());
+    key.pot = state.get_pot_size();
+    key.last_raise = state.get_last_raise_size();
+    key.big_blind = state.get_big_blind_size();
+    key.raise_count = state.get_street_raise_count();
+    for (int bet : state.get_current_bets()) key.max_bet = std::max(key.max_bet, bet);
+    if (key.player >= 0 && key.player < state.get_num_players()) {
+        key.player_folded = state.is_player_folded(key.player);
+        key.player_stack = state.get_player_stack(key.player);
+        key.player_bet = state.get_current_bets()[key.player];
+    }
+    return key;
+}
+
+uint64_t PublicBettingKey::hash() const {
+    uint64_t h = splitmix64((static_cast<uint64_t>(static_cast<uint8_t>(street)) << 16) |
+                            (static_cast<uint64_t>(static_cast<uint8_t>(player)) << 8) | player_folded);
+    for (int32_t field : {player_stack, player_bet, max_bet, pot, last_raise, big_blind, raise_count}) {
+        h = splitmix64(h ^ static_cast<uint32_t>(field));
+    }
+    return h;
+}
+
+LegalActionCache::LegalActionCache(const ActionAbstraction& action_abstraction)
+    : action_abstraction_(action_abstraction) {}
+
+std::span<const Action> LegalActionCache::get(const GameState& state, bool* hit) {
+    const PublicBettingKey key = PublicBettingKey::from_state(state);
+    const uint64_t h = key.hash();
+    // Bits de poids fort pour le segment, la table interne utilisant les bits de poids faible
+    Shard& shard = shards_[(h >> 58) % NUM_SHARDS];
+    {
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.lists.find(key);
+        if (it != shard.lists.end()) {
+            if (hit) *hit = true;
+            return it->second;
+        }
+    }
+    // Calcul hors verrou ; si un autre thread a inséré entre-temps, sa liste (identique) est gardée
+    std::vector<Action> actions = action_abstraction_.get_abstract_actions(state);
+    std::unique_lock lock(shard.mutex);
+    if (hit) *hit = false;
+    return shard.lists.try_emplace(key, std::move(actions)).first->second;
+}
+
+size_t LegalActionCache::size() const {
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+        std::shared_lock lock(shard.mutex);
+        total += shard.lists.size();
+    }
+    return total;
+}
+
+void LegalActionCache::clear() {
+    for (Shard& shard : shards_) {
+        std::unique_lock lock(shard.mutex);
+        shard.lists.clear();
+    }
+}
+
+} // namespace gto_solver
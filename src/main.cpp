@@ -1,6 +1,9 @@
 #include "gto/game_state.h"
 #include "gto/action_abstraction.h"
 #include "gto/cfr_engine.h"
+#include "gto/tree_estimator.h"
+#include "gto/training_scheduler.h"
+#include "gto/solver_config.h"
 #include "spdlog/spdlog.h"
 
 #include <iostream>   // std::cerr
@@ -9,72 +12,54 @@
 #include <exception>  // std::exception
 #include <sstream>    // std::stringstream
 #include <iomanip>    // std::setprecision
-#include <set>        // std::set
 
-int main(int /*argc*/, char* /*argv*/[])
+int main(int argc, char* argv[])
 {
     // ─────────────────────────────────────────────────────────────
     // Logging
     // ─────────────────────────────────────────────────────────────
     spdlog::set_level(spdlog::level::info);
-    spdlog::info("Démarrage du solveur GTO…");
-
-    // ─────────────────────────────────────────────────────────────
-    // Paramètres généraux
-    // ─────────────────────────────────────────────────────────────
-    const int         num_players      = 2;
-    const int         initial_stack    = 200;
-    const int         ante             = 0;
-    const int         button_pos       = 0;
-    const int         big_blind        = 2;
-    const int         num_iterations   = 4;            // Valeur basse pour test
-    const std::string infoset_filename = "infoset_map.dat";
 
     try
     {
-        // 1. État de jeu « template »
-        gto_solver::GameState initial_state_template(
-            num_players, initial_stack, ante, button_pos, big_blind);
-        spdlog::info("État de jeu initial (template) créé.");
-
-        // 2. Créer l’abstraction d’action (configuration enrichie)
-        // --------------------------------------------------------
-
-        // Fractions de pot par street
-        gto_solver::ActionAbstraction::StreetFractionsMap fractions = {
-            {gto_solver::Street::PREFLOP, {0.5, 0.75, 1.0, 1.25}},
-            {gto_solver::Street::FLOP,    {0.25, 0.33, 0.5, 0.66, 0.75, 1.0, 1.25, 1.5}},
-            {gto_solver::Street::TURN,    {0.33, 0.5, 0.66, 0.75, 1.0, 1.25, 1.5, 2.0}},
-            {gto_solver::Street::RIVER,   {0.33, 0.5, 0.75, 1.0, 1.5, 2.0, 2.5}}
-        };
-
-        // Tailles en BB par street
-        gto_solver::ActionAbstraction::StreetBBSizesMap bb_sizes = {
-            {gto_solver::Street::PREFLOP, {2.2, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0}},
-            {gto_solver::Street::FLOP,    {1.0, 1.5, 2.0}},
-            {gto_solver::Street::TURN,    {1.5, 2.0, 2.5}},
-            {gto_solver::Street::RIVER,   {2.0, 2.5, 3.0}}
-        };
+        // ─────────────────────────────────────────────────────────────
+        // Paramètres : fichier(s) --config puis surcharges de la ligne de commande
+        // ─────────────────────────────────────────────────────────────
+        const gto_solver::CommandLine command_line = gto_solver::parse_command_line(argc, argv);
+        if (command_line.show_help)
+        {
+            std::cout << gto_solver::command_line_usage(argv[0]);
+            return 0;
+        }
+        const gto_solver::SolverConfig config = gto_solver::SolverConfig::from_ini(command_line.ini);
+        spdlog::set_level(config.log_level);
+        spdlog::info("Démarrage du solveur GTO…");
+        const std::string& infoset_filename = config.infoset_file;
 
-        // Mises exactes par street
-        gto_solver::ActionAbstraction::StreetExactBetsMap exact_bets = {
-            {gto_solver::Street::FLOP,  {5, 8, 10, 12, 15, 20, 25, 30}},
-            {gto_solver::Street::TURN,  {10, 15, 20, 25, 30, 40, 50}},
-            {gto_solver::Street::RIVER, {20, 30, 40, 50, 75, 100}}
-        };
+        // 1. État de jeu « template »
+        gto_solver::GameState initial_state_template = config.game.make_initial_state();
+        spdlog::info("État de jeu initial (template) créé : {} joueurs, BB {}.",
+                     config.game.num_players, config.game.big_blind);
 
-        gto_solver::ActionAbstraction abstraction(
-            /*allow_folds*/       true,
-            /*allow_check_call*/  true,
-            fractions,
-            bb_sizes,
-            exact_bets,
-            /*allow_all_in*/      true);
+        // 2. Créer l’abstraction d’action
+        gto_solver::ActionAbstraction abstraction(config.abstraction);
+        spdlog::info("Abstraction d’actions créée ({} actions max par nœud).", abstraction.max_actions());
 
-        spdlog::info("Abstraction d’actions enrichie créée.");
+        // Taille de l’arbre et mémoire projetée, avant de lancer l’entraînement
+        if (config.estimate_tree || config.estimate_only)
+        {
+            const gto_solver::TreeEstimate estimate =
+                gto_solver::estimate_tree_size(initial_state_template, abstraction, config.estimator);
+            spdlog::info("Estimation de l’arbre :\n{}", estimate.report());
+        }
+        if (config.estimate_only)
+        {
+            spdlog::info("Estimation seule demandée : pas d’entraînement.");
+            return 0;
+        }
 
         // 3. Initialiser le moteur CFR
-        gto_solver::CFREngine engine(abstraction);
+        gto_solver::CFREngine engine(abstraction, config.engine);
         spdlog::info("Moteur CFR initialisé.");
 
         // 4. Charger une éventuelle map d’infosets
@@ -85,10 +70,11 @@ int main(int /*argc*/, char* /*argv*/[])
             spdlog::info("Pas de map d’infosets existante ({}) – nouvel entraînement.",
                          infoset_filename);
 
-        // 5. Exécuter les itérations CFR
-        spdlog::info("Lancement de {} itérations CFR…", num_iterations);
-        engine.run_iterations(num_iterations, initial_state_template);
-        spdlog::info("Entraînement CFR terminé.");
+        // 5. Entraînement (budget d’itérations / de temps, évaluations, checkpoints)
+        gto_solver::TrainingScheduler scheduler(engine, abstraction, config.training);
+        const gto_solver::TrainingReport report = scheduler.run(initial_state_template);
+        spdlog::info("Entraînement CFR terminé ({} itérations, arrêt : {}).",
+                     report.final_progress.iterations, gto_solver::stop_reason_to_string(report.stop_reason));
 
         // 6. Sauvegarder la map d’infosets
         spdlog::info("Infosets après entraînement : {}",
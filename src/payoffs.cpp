@@ -0,0 +1,148 @@
+#include "gto/payoffs.h"
+#include "core/bitboard.hpp"
+#include "core/deck.hpp" // Pour deal_cards
+#include "spdlog/spdlog.h"
+#include <algorithm>
+
+namespace gto_solver {
+
+namespace {
+
+// Ajoute à total les utilités du showdown sur le board complet board_mask.
+void add_showdown(const GameState& state, const std::array<Bitboard, MAX_PLAYERS>& hand_masks,
+                  Bitboard board_mask, UtilityVector& total, long long& hand_evaluations) {
+    std::array<HandRank, MAX_PLAYERS> ranks{};
+    for (int p = 0; p < state.get_num_players(); ++p) {
+        if (state.is_player_folded(p)) continue;
+        ranks[p] = evaluate_hand_7_card(hand_masks[p] | board_mask);
+        hand_evaluations++;
+    }
+    const UtilityVector utilities = showdown_utilities(state, ranks);
+    for (int p = 0; p < state.get_num_players(); ++p) total[p] += utilities[p];
+}
+
+// Somme des utilités sur les runouts complétant board_mask (cartes disponibles : available,
+// énumérées par ordre croissant pour ne visiter chaque ensemble qu'une fois).
+void accumulate_runouts(const GameState& state, const std::array<Bitboard, MAX_PLAYERS>& hand_masks,
+                        Bitboard board_mask, Bitboard available, int cards_to_come,
+                        UtilityVector& total, long long& runouts, long long& hand_evaluations) {
+    if (cards_to_come == 0) {
+        add_showdown(state, hand_masks, board_mask, total, hand_evaluations);
+        runouts++;
+        return;
+    }
+    while (available) {
+        const Card card = pop_lsb(available);
+        Bitboard next_board = board_mask;
+        set_card(next_board, card);
+        accumulate_runouts(state, hand_masks, next_board, available, cards_to_come - 1, total, runouts, hand_evaluations);
+    }
+}
+
+// Nombre de runouts : combinaisons de k cartes parmi n.
+double count_runouts(int n, int k) {
+    double count = 1.0;
+    for (int i = 0; i < k; ++i) count = count * (n - i) / (i + 1);
+    return count;
+}
+
+} // namespace
+
+UtilityVector showdown_utilities(const GameState& state, const std::array<HandRank, MAX_PLAYERS>& hand_ranks) {
+    const int num_players = state.get_num_players();
+    UtilityVector utilities{};
+
+    // Joueurs en main, du meilleur au moins bon (un seul tri par nœud terminal)
+    std::array<int, MAX_PLAYERS> order{};
+    int num_active = 0;
+    for (int p = 0; p < num_players; ++p) {
+        if (!state.is_player_folded(p)) order[num_active++] = p;
+    }
+    std::sort(order.begin(), order.begin() + num_active,
+              [&](int a, int b) { return hand_ranks[a] < hand_ranks[b]; });
+
+    for (const SidePot& pot : state.get_side_pots()) {
+        std::array<bool, MAX_PLAYERS> eligible{};
+        for (int p : pot.eligible_players) eligible[p] = true;
+
+        // Meilleur rang parmi les éligibles, puis tous les éligibles à égalité
+        std::array<int, MAX_PLAYERS> winners{};
+        int num_winners = 0;
+        for (int i = 0; i < num_active; ++i) {
+            const int p = order[i];
+            if (!eligible[p]) continue;
+            if (num_winners > 0 && hand_ranks[p] != hand_ranks[winners[0]]) break;
+            winners[num_winners++] = p;
+        }
+        if (num_winners == 0) {
+            spdlog::error("showdown_utilities: pot de {} sans joueur éligible. State:\n{}", pot.amount, state.toString());
+            continue;
+        }
+        const double share = static_cast<double>(pot.amount) / num_winners;
+        for (int w = 0; w < num_winners; ++w) utilities[winners[w]] += share;
+    }
+
+    for (int p = 0; p < num_players; ++p) utilities[p] -= state.get_player_contribution(p);
+    return utilities;
+}
+
+UtilityVector terminal_utilities(const GameState& state, long long& hand_evaluations, Rng* rng, int max_runouts) {
+    const int num_players = state.get_num_players();
+    int num_active = 0;
+    for (int p = 0; p < num_players; ++p) {
+        if (!state.is_player_folded(p)) num_active++;
+    }
+    if (num_active <= 1) return showdown_utilities(state, {}); // Tous couchés sauf un : il gagne tous les pots
+
+    Bitboard board_mask = EMPTY_BOARD;
+    for (int i = 0; i < state.get_board_cards_dealt(); ++i) set_card(board_mask, state.get_board()[i]);
+    std::array<Bitboard, MAX_PLAYERS> hand_masks{};
+    for (int p = 0; p < num_players; ++p) {
+        if (state.is_player_folded(p)) continue;
+        for (Card c : state.get_player_hand(p)) {
+            if (c == INVALID_CARD) {
+                spdlog::error("terminal_utilities: main privée absente pour P{}. State:\n{}", p, state.toString());
+                return UtilityVector{};
+            }
+            set_card(hand_masks[p], c);
+        }
+    }
+
+    UtilityVector total{};
+    long long runouts = 0;
+    const Bitboard available = state.get_remaining_deck_mask();
+    const int cards_to_come = 5 - state.get_board_cards_dealt();
+    if (rng && max_runouts > 0 && count_runouts(count_set_bits(available), cards_to_come) > max_runouts) {
+        // Runouts tirés : coût borné dans la traversée, moyenne exacte en espérance
+        for (; runouts < max_runouts; ++runouts) {
+            const Bitboard runout = deal_cards(~available, cards_to_come, *rng);
+            add_showdown(state, hand_masks, board_mask | runout, total, hand_evaluations);
+        }
+    } else {
+        accumulate_runouts(state, hand_masks, board_mask, available, cards_to_come, total, runouts, hand_evaluations);
+    }
+    if (runouts > 0) {
+        for (double& u : total) u /= runouts;
+    }
+    return total;
+}
+
+double heads_up_terminal_utility(const GameState& state, long long& hand_evaluations, Rng* rng, int max_runouts) {
+    if (state.is_player_folded(0)) return -state.get_player_contribution(0);
+    if (state.is_player_folded(1)) return state.get_player_contribution(1);
+    if (state.get_board_cards_dealt() < 5) return terminal_utilities(state, hand_evaluations, rng, max_runouts)[0];
+
+    Bitboard board_mask = EMPTY_BOARD;
+    for (Card c : state.get_board()) set_card(board_mask, c);
+    std::array<HandRank, 2> ranks{};
+    for (int p = 0; p < 2; ++p) {
+        Bitboard mask = board_mask;
+        for (Card c : state.get_player_hand(p)) set_card(mask, c);
+        ranks[p] = evaluate_hand_7_card(mask);
+    }
+    hand_evaluations += 2;
+    const double stake = std::min(state.get_player_contribution(0), state.get_player_contribution(1));
+    return ranks[0] < ranks[1] ? stake : ranks[0] > ranks[1] ? -stake : 0.0;
+}
+
+} // namespace gto_solver
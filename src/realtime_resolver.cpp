@@ -0,0 +1,178 @@
+#include "gto/realtime_resolver.h"
+#include "gto/information_set.h"
+#include "gto/action_translation.h"
+#include "spdlog/spdlog.h"
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+
+namespace gto_solver {
+
+RealtimeResolver::RealtimeResolver(const ActionAbstraction& action_abstraction,
+                                   const RealtimeResolverConfig& config)
+    : action_abstraction_(action_abstraction),
+      config_(config),
+      translator_(action_abstraction, config.translation_mode),
+      blueprint_(action_abstraction),
+      blueprint_leaves_(blueprint_, action_abstraction, config.rollout_boards),
+      solver_(action_abstraction,
+              config.blueprint_leaves ? static_cast<const LeafValueEstimator&>(blueprint_leaves_)
+                                      : static_cast<const LeafValueEstimator&>(equity_leaves_),
+              config.subgame) {}
+
+bool RealtimeResolver::load_blueprint(const std::string& filename) {
+    if (!blueprint_.load_infoset_map(filename)) return false;
+    spdlog::info("RealtimeResolver: blueprint chargé ({} infosets)", blueprint_.get_infoset_map().size());
+    return true;
+}
+
+std::array<RangeVector, 2> RealtimeResolver::derive_ranges(const GameState& initial_state,
+                                                           const std::vector<Action>& action_history,
+                                                           const GameState& current_state,
+                                                           std::vector<Action>* abstract_history) const {
+    if (initial_state.get_num_players() != 2) {
+        throw std::invalid_argument("RealtimeResolver: seul le heads-up est supporté");
+    }
+    GameState state = initial_state;
+    state.clear_private_cards();
+    state.set_explicit_chance_nodes(true);
+    // Partie abstraite rejouée en parallèle : actions traduites, clés du blueprint
+    GameState abstract_state = state;
+    bool abstract_tracked = true;
+
+    // Les cartes de board sont celles du spot courant, dans l'ordre où elles ont été données.
+    // false si le board courant ne suffit pas.
+    auto deal_known_cards = [&](GameState& s) {
+        while (s.is_chance_node()) {
+            const int index = s.get_board_cards_dealt();
+            if (index >= current_state.get_board_cards_dealt()) return false;
+            s.deal_board_card(current_state.get_board()[index]);
+        }
+        return true;
+    };
+
+    std::array<RangeVector, 2> ranges{RangeVector(NUM_HOLE_COMBOS, 1.0), RangeVector(NUM_HOLE_COMBOS, 1.0)};
+    const InformationSetMap& infosets = blueprint_.get_infoset_map();
+    const auto& hole_strings = hole_combo_strings();
+    std::vector<Action> replayed; // Actions abstraites : suffixes des clés du blueprint
+    replayed.reserve(action_history.size());
+    Rng rng(config_.translation_seed);
+
+    for (const Action& action : action_history) {
+        if (!deal_known_cards(state)) {
+            throw std::invalid_argument("RealtimeResolver: l'historique dépasse le board courant");
+        }
+        const int player = state.is_terminal() ? -1 : state.get_current_player();
+        if (player < 0 || action.player_index != player) {
+            throw std::invalid_argument("RealtimeResolver: historique incompatible avec l'état initial");
+        }
+
+        // La partie abstraite peut s'arrêter avant la réelle (all-in abstrait suivi) : le
+        // blueprint n'a plus rien à dire, les ranges restent inchangées.
+        if (abstract_tracked &&
+            (!deal_known_cards(abstract_state) || abstract_state.is_terminal() ||
+             abstract_state.get_current_player() != player ||
+             abstract_state.get_current_street() != state.get_current_street())) {
+            spdlog::warn("RealtimeResolver: l'historique sort de l'arbre abstrait, ranges figées");
+            abstract_tracked = false;
+        }
+        if (!abstract_tracked) {
+            state.apply_action(action);
+            replayed.push_back(action);
+            continue;
+        }
+
+        // Relance réelle : fraction de pot mesurée dans la partie réelle, traduite vers les
+        // tailles de la partie abstraite
+        const std::vector<Action> legal_actions = abstract_state.get_legal_abstract_actions(action_abstraction_);
+        const TranslationTable table(abstract_state, legal_actions);
+        const TranslatedAction translated = action.type == ActionType::RAISE
+            ? table.translate_raise_fraction(raise_pot_fraction(state, action.amount))
+            : table.translate(action);
+        state.apply_action(action);
+        if (!translated.valid()) {
+            // Aucune action abstraite de ce type : non informative, la range est inchangée
+            spdlog::warn("RealtimeResolver: action sans équivalent abstrait, ranges figées");
+            abstract_tracked = false;
+            replayed.push_back(action);
+            continue;
+        }
+
+        const size_t num_actions = legal_actions.size();
+        const std::string key_prefix = "P" + std::to_string(player) + ";";
+        const std::string full_key = InformationSet::generate_key(
+            player, {}, abstract_state.get_board(), abstract_state.get_board_cards_dealt(),
+            abstract_state.get_current_street(), replayed);
+        const std::string key_suffix = full_key.substr(full_key.find('|'));
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (ranges[player][h] == 0.0) continue;
+            double probability = 1.0 / num_actions; // Infoset jamais visité : stratégie uniforme
+            auto it = infosets.find(key_prefix + hole_strings[h] + key_suffix);
+            if (it != infosets.end() && it->second.num_actions() == num_actions) {
+                double sum = 0.0;
+                for (size_t a = 0; a < num_actions; ++a) sum += it->second.get_strategy_sum(a);
+                if (sum > 0.0) {
+                    probability = translated.lower_probability * it->second.get_strategy_sum(translated.lower) / sum +
+                                  (1.0 - translated.lower_probability) * it->second.get_strategy_sum(translated.upper) / sum;
+                }
+            }
+            ranges[player][h] *= probability;
+        }
+        const Action& abstract_action = legal_actions[translator_.resolve(translated, rng)];
+        abstract_state.apply_action(abstract_action);
+        replayed.push_back(abstract_action);
+    }
+    if (!deal_known_cards(state)) {
+        throw std::invalid_argument("RealtimeResolver: l'historique dépasse le board courant");
+    }
+
+    if (state.is_terminal() || state.get_current_street() != current_state.get_current_street() ||
+        state.get_current_player() != current_state.get_current_player() ||
+        state.get_board_cards_dealt() != current_state.get_board_cards_dealt()) {
+        throw std::invalid_argument("RealtimeResolver: l'historique ne mène pas à l'état courant");
+    }
+
+    Bitboard board_mask = EMPTY_BOARD;
+    for (int i = 0; i < state.get_board_cards_dealt(); ++i) set_card(board_mask, state.get_board()[i]);
+    for (int p = 0; p < 2; ++p) {
+        remove_blocked_combos(ranges[p], board_mask);
+        if (std::accumulate(ranges[p].begin(), ranges[p].end(), 0.0) <= 0.0) {
+            spdlog::warn("RealtimeResolver: range vide pour le joueur {}, range uniforme utilisée", p);
+            ranges[p] = make_uniform_range(board_mask);
+        }
+    }
+    if (abstract_history) *abstract_history = std::move(replayed);
+    return ranges;
+}
+
+ResolveResult RealtimeResolver::resolve(const GameState& initial_state,
+                                        const std::vector<Action>& action_history,
+                                        const GameState& current_state) {
+    const auto start_time = std::chrono::steady_clock::now();
+    ResolveResult result;
+    // Clés du blueprint (construction, warm-start, feuilles) : historique traduit
+    std::vector<Action> abstract_history;
+    result.ranges = derive_ranges(initial_state, action_history, current_state, &abstract_history);
+
+    GameState root = current_state;
+    root.clear_private_cards();
+    solved_ = false;
+    solver_.build(root, abstract_history, result.ranges);
+    if (config_.warm_start_weight > 0.0) {
+        result.warm_started_infosets = solver_.warm_start(blueprint_.get_infoset_map(), config_.warm_start_weight);
+    }
+    result.solve = solver_.solve();
+    solved_ = true;
+    result.actions = solver_.get_root_actions();
+    result.total_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    spdlog::info("RealtimeResolver: résolution en {:.3f}s ({} infosets warm-startés)",
+                 result.total_seconds, result.warm_started_infosets);
+    return result;
+}
+
+std::vector<double> RealtimeResolver::get_strategy(Card c1, Card c2) const {
+    if (!solved_) throw std::logic_error("RealtimeResolver::get_strategy: aucune résolution");
+    return solver_.get_root_strategy(combo_index(c1, c2));
+}
+
+} // namespace gto_solver
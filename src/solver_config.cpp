@@ -0,0 +1,281 @@
+#include "gto/solver_config.h"
+#include <algorithm>
+#include <initializer_list>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace gto_solver {
+
+GameState GameConfig::make_initial_state() const {
+    if (stacks.empty()) return GameState(num_players, initial_stack, ante, button_pos, big_blind);
+    if (static_cast<int>(stacks.size()) != num_players) {
+        throw std::invalid_argument("[game] stacks: " + std::to_string(stacks.size()) + " stacks pour " +
+                                    std::to_string(num_players) + " joueurs");
+    }
+    return GameState(stacks, ante, button_pos, big_blind);
+}
+
+ActionAbstractionConfig SolverConfig::default_abstraction() {
+    const ActionAbstraction::StreetFractionsMap fractions = {
+        {Street::PREFLOP, {0.5, 0.75, 1.0, 1.25}},
+        {Street::FLOP,    {0.25, 0.33, 0.5, 0.66, 0.75, 1.0, 1.25, 1.5}},
+        {Street::TURN,    {0.33, 0.5, 0.66, 0.75, 1.0, 1.25, 1.5, 2.0}},
+        {Street::RIVER,   {0.33, 0.5, 0.75, 1.0, 1.5, 2.0, 2.5}}
+    };
+    const ActionAbstraction::StreetBBSizesMap bb_sizes = {
+        {Street::PREFLOP, {2.2, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0}},
+        {Street::FLOP,    {1.0, 1.5, 2.0}},
+        {Street::TURN,    {1.5, 2.0, 2.5}},
+        {Street::RIVER,   {2.0, 2.5, 3.0}}
+    };
+    const ActionAbstraction::StreetExactBetsMap exact_bets = {
+        {Street::FLOP,  {5, 8, 10, 12, 15, 20, 25, 30}},
+        {Street::TURN,  {10, 15, 20, 25, 30, 40, 50}},
+        {Street::RIVER, {20, 30, 40, 50, 75, 100}}
+    };
+    ActionAbstractionConfig config;
+    for (Street street : {Street::PREFLOP, Street::FLOP, Street::TURN, Street::RIVER}) {
+        RaiseSizing sizing;
+        if (fractions.count(street)) sizing.pot_fractions = fractions.at(street);
+        if (bb_sizes.count(street)) sizing.bb_sizes = bb_sizes.at(street);
+        if (exact_bets.count(street)) sizing.exact_bets = exact_bets.at(street);
+        config.streets[street].raise_levels.push_back(std::move(sizing));
+    }
+    return config;
+}
+
+TrainingSchedulerConfig SolverConfig::default_training() {
+    TrainingSchedulerConfig config;
+    config.budget.max_iterations = 4; // Valeur basse pour test
+    config.enable_evaluation = false; // Meilleure réponse coûteuse sur l'arbre complet
+    return config;
+}
+
+TreeEstimatorConfig SolverConfig::default_estimator() {
+    TreeEstimatorConfig config;
+    config.max_public_nodes = 500000;
+    return config;
+}
+
+namespace {
+
+// Valeur énumérée lue par son nom ; lève std::invalid_argument avec la liste des noms.
+template <typename Enum>
+Enum get_choice(const IniFile& ini, const std::string& section, const std::string& key, Enum fallback,
+                std::initializer_list<std::pair<const char*, Enum>> choices) {
+    const auto value = ini.get(section, key);
+    if (!value) return fallback;
+    std::string names;
+    for (const auto& [name, choice] : choices) {
+        if (*value == name) return choice;
+        names += names.empty() ? name : std::string(", ") + name;
+    }
+    throw std::invalid_argument("[" + section + "] " + key + ": '" + *value + "' inconnu (" + names + ")");
+}
+
+bool has_abstraction_sections(const IniFile& ini) {
+    static const char* const PREFIXES[] = {"abstraction", "preflop", "flop", "turn", "river"};
+    for (const std::string& section : ini.sections()) {
+        const std::string head = section.substr(0, section.find('.'));
+        if (std::find(std::begin(PREFIXES), std::end(PREFIXES), head) != std::end(PREFIXES)) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+SolverConfig SolverConfig::from_ini(const IniFile& ini) {
+    SolverConfig config;
+
+    ini.require_known_keys("game", {"num_players", "initial_stack", "stacks", "ante", "button", "big_blind"});
+    GameConfig& game = config.game;
+    game.num_players = ini.get_int("game", "num_players", game.num_players);
+    game.initial_stack = ini.get_int("game", "initial_stack", game.initial_stack);
+    if (ini.has("game", "stacks")) game.stacks = ini.get_int_list("game", "stacks");
+    game.ante = ini.get_int("game", "ante", game.ante);
+    game.button_pos = ini.get_int("game", "button", game.button_pos);
+    game.big_blind = ini.get_int("game", "big_blind", game.big_blind);
+    if (game.num_players < 2 || game.num_players > MAX_PLAYERS) {
+        throw std::invalid_argument("[game] num_players doit être entre 2 et " + std::to_string(MAX_PLAYERS));
+    }
+
+    if (has_abstraction_sections(ini)) config.abstraction = ActionAbstractionConfig::from_ini(ini);
+
+    ini.require_known_keys("engine", {"traversal", "chance_sampling", "board_chance", "suit_isomorphic",
+                                      "chance_threads", "runout_samples", "seed", "regret_pruning", "pruning_threshold",
+                                      "pruning_warmup", "pruning_interval", "reach_pruning",
+                                      "reach_pruning_epsilon", "transpositions", "cache_legal_actions",
+                                      "street_timing"});
+    CFREngineConfig& engine = config.engine;
+    engine.traversal_mode = get_choice(ini, "engine", "traversal", engine.traversal_mode,
+        {{"vanilla", TraversalMode::VANILLA}, {"pcs", TraversalMode::PUBLIC_CHANCE_SAMPLING}});
+    engine.chance_sampling = get_choice(ini, "engine", "chance_sampling", engine.chance_sampling,
+        {{"fixed", ChanceSampling::FIXED_DEAL}, {"sample", ChanceSampling::SAMPLE_DEAL}});
+    engine.board_chance = get_choice(ini, "engine", "board_chance", engine.board_chance,
+        {{"dealt", BoardChance::DEALT}, {"sample", BoardChance::SAMPLE}, {"enumerate", BoardChance::ENUMERATE}});
+    engine.suit_isomorphic_chance = ini.get_bool("engine", "suit_isomorphic", engine.suit_isomorphic_chance);
+    engine.chance_threads = ini.get_int("engine", "chance_threads", engine.chance_threads);
+    engine.terminal_runout_samples = ini.get_int("engine", "runout_samples", engine.terminal_runout_samples);
+    engine.seed = static_cast<uint64_t>(ini.get_int64("engine", "seed", static_cast<long long>(engine.seed)));
+    engine.enable_regret_pruning = ini.get_bool("engine", "regret_pruning", engine.enable_regret_pruning);
+    engine.pruning_threshold = ini.get_double("engine", "pruning_threshold", engine.pruning_threshold);
+    engine.pruning_warmup_iterations = ini.get_int("engine", "pruning_warmup", engine.pruning_warmup_iterations);
+    engine.pruning_full_traversal_interval =
+        ini.get_int("engine", "pruning_interval", engine.pruning_full_traversal_interval);
+    engine.enable_reach_pruning = ini.get_bool("engine", "reach_pruning", engine.enable_reach_pruning);
+    engine.reach_pruning_epsilon = ini.get_double("engine", "reach_pruning_epsilon", engine.reach_pruning_epsilon);
+    engine.transpositions = get_choice(ini, "engine", "transpositions", engine.transpositions,
+        {{"none", TranspositionRule::NONE}, {"public_state", TranspositionRule::PUBLIC_STATE}});
+    engine.cache_legal_actions = ini.get_bool("engine", "cache_legal_actions", engine.cache_legal_actions);
+    engine.enable_street_timing = ini.get_bool("engine", "street_timing", engine.enable_street_timing);
+
+    ini.require_known_keys("storage", {"regrets", "strategy", "regret_scale"});
+    StoragePrecision& storage = engine.storage_precision;
+    storage.regrets = get_choice(ini, "storage", "regrets", storage.regrets,
+        {{"double", RegretStorage::DOUBLE}, {"int32", RegretStorage::INT32_SCALED}});
+    storage.strategy = get_choice(ini, "storage", "strategy", storage.strategy,
+        {{"double", StrategyStorage::DOUBLE}, {"float32", StrategyStorage::FLOAT32}, {"float16", StrategyStorage::FLOAT16}});
+    storage.regret_scale = ini.get_double("storage", "regret_scale", storage.regret_scale);
+
+    ini.require_known_keys("training", {"iterations", "max_seconds", "target_mbb", "evaluate", "evaluation_samples",
+                                        "evaluation_threads", "max_evaluation_fraction", "min_evaluation_interval",
+                                        "max_evaluation_interval", "batch_iterations"});
+    TrainingSchedulerConfig& training = config.training;
+    training.budget.max_iterations = ini.get_int("training", "iterations", training.budget.max_iterations);
+    training.budget.max_seconds = ini.get_double("training", "max_seconds", training.budget.max_seconds);
+    training.budget.target_exploitability_mbb =
+        ini.get_double("training", "target_mbb", training.budget.target_exploitability_mbb);
+    training.enable_evaluation = ini.get_bool("training", "evaluate", training.enable_evaluation);
+    training.evaluation_chance_samples = ini.get_int("training", "evaluation_samples", training.evaluation_chance_samples);
+    training.evaluation_threads = ini.get_int("training", "evaluation_threads", training.evaluation_threads);
+    training.max_evaluation_time_fraction =
+        ini.get_double("training", "max_evaluation_fraction", training.max_evaluation_time_fraction);
+    training.min_iterations_between_evaluations =
+        ini.get_int("training", "min_evaluation_interval", training.min_iterations_between_evaluations);
+    training.max_iterations_between_evaluations =
+        ini.get_int("training", "max_evaluation_interval", training.max_iterations_between_evaluations);
+    training.max_batch_iterations = ini.get_int("training", "batch_iterations", training.max_batch_iterations);
+
+    ini.require_known_keys("checkpoint", {"infoset_file", "file", "interval_seconds", "delta", "metrics_file"});
+    config.infoset_file = ini.get_string("checkpoint", "infoset_file", config.infoset_file);
+    training.checkpoint_file = ini.get_string("checkpoint", "file", training.checkpoint_file);
+    training.checkpoint_interval_seconds =
+        ini.get_double("checkpoint", "interval_seconds", training.checkpoint_interval_seconds);
+    training.use_delta_checkpoints = ini.get_bool("checkpoint", "delta", training.use_delta_checkpoints);
+    training.metrics_file = ini.get_string("checkpoint", "metrics_file", training.metrics_file);
+
+    ini.require_known_keys("estimator", {"enabled", "only", "max_nodes", "threads", "transpositions"});
+    config.estimate_tree = ini.get_bool("estimator", "enabled", config.estimate_tree);
+    config.estimate_only = ini.get_bool("estimator", "only", config.estimate_only);
+    config.estimator.max_public_nodes = ini.get_int64("estimator", "max_nodes", config.estimator.max_public_nodes);
+    config.estimator.threads = ini.get_int("estimator", "threads", config.estimator.threads);
+    config.estimator.count_transpositions =
+        ini.get_bool("estimator", "transpositions", config.estimator.count_transpositions);
+
+    ini.require_known_keys("log", {"level"});
+    config.log_level = get_choice(ini, "log", "level", config.log_level,
+        {{"trace", spdlog::level::trace}, {"debug", spdlog::level::debug}, {"info", spdlog::level::info},
+         {"warn", spdlog::level::warn}, {"err", spdlog::level::err}, {"critical", spdlog::level::critical},
+         {"off", spdlog::level::off}});
+    return config;
+}
+
+namespace {
+
+// Raccourcis de la ligne de commande : drapeau -> clés surchargées.
+struct Shortcut {
+    const char* flag;
+    std::vector<std::pair<const char*, const char*>> targets;
+};
+
+const std::vector<Shortcut>& shortcuts() {
+    static const std::vector<Shortcut> SHORTCUTS = {
+        {"iterations", {{"training", "iterations"}}},
+        {"seconds", {{"training", "max_seconds"}}},
+        {"threads", {{"engine", "chance_threads"}, {"training", "evaluation_threads"}, {"estimator", "threads"}}},
+        {"seed", {{"engine", "seed"}}},
+        {"output", {{"checkpoint", "infoset_file"}}},
+    };
+    return SHORTCUTS;
+}
+
+void merge_into(IniFile& target, const IniFile& source) {
+    for (const std::string& section : source.sections()) {
+        for (const std::string& key : source.keys(section)) target.set(section, key, *source.get(section, key));
+    }
+}
+
+} // namespace
+
+CommandLine parse_command_line(int argc, const char* const argv[]) {
+    CommandLine command_line;
+    // Surcharges appliquées après les fichiers, quel que soit leur ordre sur la ligne
+    std::vector<std::pair<std::string, std::string>> overrides;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            command_line.show_help = true;
+            continue;
+        }
+        if (arg == "--estimate-only") {
+            overrides.emplace_back("estimator.only", "true");
+            continue;
+        }
+        if (arg.rfind("--", 0) != 0 || arg.size() == 2) throw std::invalid_argument("argument inattendu : " + arg);
+        std::string name = arg.substr(2);
+        std::string value;
+        const size_t equals = name.find('=');
+        if (equals != std::string::npos) {
+            value = name.substr(equals + 1);
+            name = name.substr(0, equals);
+        } else if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+            value = argv[++i];
+        } else {
+            // Pas de valeur, ou l'argument suivant est une autre option (--config --iterations 5)
+            throw std::invalid_argument("valeur manquante pour --" + name);
+        }
+
+        if (name == "config") {
+            merge_into(command_line.ini, IniFile::load(value));
+            continue;
+        }
+        const auto shortcut = std::find_if(shortcuts().begin(), shortcuts().end(),
+                                           [&](const Shortcut& s) { return name == s.flag; });
+        if (shortcut != shortcuts().end()) {
+            for (const auto& [section, key] : shortcut->targets) overrides.emplace_back(std::string(section) + "." + key, value);
+            continue;
+        }
+        // --<section>.<cle> : la clé est après le dernier point (les sections de niveau
+        // de relance contiennent elles-mêmes un point, ex. --flop.raise1.pot_fractions)
+        const size_t dot = name.rfind('.');
+        if (dot == std::string::npos || dot == 0 || dot + 1 == name.size()) {
+            throw std::invalid_argument("option inconnue : --" + name + " (attendu --<section>.<cle>)");
+        }
+        overrides.emplace_back(name, value);
+    }
+    for (const auto& [name, value] : overrides) {
+        const size_t dot = name.rfind('.');
+        command_line.ini.set(name.substr(0, dot), name.substr(dot + 1), value);
+    }
+    return command_line;
+}
+
+std::string command_line_usage(const std::string& program_name) {
+    std::ostringstream ss;
+    ss << "Usage : " << program_name << " [--config fichier.ini] [--<section>.<cle>=<valeur>...]\n"
+       << "  --config <fichier>        Configuration INI (plusieurs fichiers : les derniers l'emportent)\n"
+       << "  --<section>.<cle> <val>   Surcharge une clé, ex. --engine.board_chance=enumerate\n"
+       << "  --iterations <n>          = --training.iterations\n"
+       << "  --seconds <s>             = --training.max_seconds\n"
+       << "  --threads <n>             Threads du moteur, de l'évaluation et de l'estimateur\n"
+       << "  --seed <n>                = --engine.seed\n"
+       << "  --output <fichier>        = --checkpoint.infoset_file\n"
+       << "  --estimate-only           Estime la taille de l'arbre puis s'arrête\n"
+       << "  -h, --help                Affiche cette aide\n"
+       << "Sections : game, engine, storage, training, checkpoint, estimator, log,\n"
+       << "           abstraction, preflop|flop|turn|river[.raise<k>] (voir config/solver.ini).\n";
+    return ss.str();
+}
+
+} // namespace gto_solver
@@ -0,0 +1,631 @@
+#include "gto/subgame_solver.h"
+#include "gto/cfr_engine.h"
+#include "gto/information_set.h"
+#include "eval/hand_evaluator.hpp" // Pour INVALID_HAND_RANK
+#include "core/deck.hpp"           // Pour deal_cards
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+
+namespace gto_solver {
+
+namespace {
+
+double binomial(int n, int k) {
+    if (k < 0 || k > n) return 0.0;
+    double result = 1.0;
+    for (int i = 1; i <= k; ++i) result = result * (n - k + i) / i;
+    return result;
+}
+
+// Combos contenant chaque carte (51 par carte).
+const std::array<std::vector<int>, NUM_CARDS>& combos_by_card() {
+    static const std::array<std::vector<int>, NUM_CARDS> table = [] {
+        std::array<std::vector<int>, NUM_CARDS> out;
+        const auto& combos = all_hole_combos();
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            out[combos[h].c1].push_back(h);
+            out[combos[h].c2].push_back(h);
+        }
+        return out;
+    }();
+    return table;
+}
+
+Bitboard board_mask_of(const GameState& state) {
+    Bitboard mask = EMPTY_BOARD;
+    for (int i = 0; i < state.get_board_cards_dealt(); ++i) set_card(mask, state.get_board()[i]);
+    return mask;
+}
+
+// Vrai si au plus un joueur non couché peut encore miser : le board est déroulé sans action.
+bool betting_is_over(const GameState& state) {
+    int players_with_chips = 0;
+    for (int p = 0; p < state.get_num_players(); ++p) {
+        if (!state.is_player_folded(p) && state.get_player_stack(p) > 0) players_with_chips++;
+    }
+    return players_with_chips <= 1;
+}
+
+// Partie publique (après le ';') de la clé d'infoset du joueur qui agit.
+std::string public_key_suffix(const GameState& state, int player, const std::vector<Action>& action_history) {
+    const std::string key = InformationSet::generate_key(
+        player, {}, state.get_board(), state.get_board_cards_dealt(), state.get_current_street(), action_history);
+    return key.substr(key.find('|'));
+}
+
+void heads_up_terminal_values(const GameState& state, int player, const RangeVector& opp_reach,
+                              const BoardRanking& ranking, RangeVector& out) {
+    const int opponent = 1 - player;
+    if (state.is_player_folded(player)) {
+        fold_values(opp_reach, -static_cast<double>(state.get_player_contribution(player)), out);
+    } else if (state.is_player_folded(opponent)) {
+        fold_values(opp_reach, static_cast<double>(state.get_player_contribution(opponent)), out);
+    } else {
+        const double stake = std::min(state.get_player_contribution(player), state.get_player_contribution(opponent));
+        showdown_values(opp_reach, ranking.hand_ranks, ranking.sorted_combos, stake, out);
+    }
+}
+
+// Complète board (dealt cartes connues) de toutes les façons possibles, dans l'ordre des cartes.
+void enumerate_runouts(std::array<Card, 5>& board, int dealt, Bitboard available,
+                       std::vector<std::array<Card, 5>>& out) {
+    if (dealt == 5) {
+        out.push_back(board);
+        return;
+    }
+    while (available) {
+        const Card c = pop_lsb(available); // Cartes suivantes > c : chaque ensemble une seule fois
+        board[dealt] = c;
+        enumerate_runouts(board, dealt + 1, available, out);
+    }
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+//  EquityLeafEstimator
+// -----------------------------------------------------------------------------
+EquityLeafEstimator::EquityLeafEstimator(int max_runouts, uint64_t seed)
+    : max_runouts_(max_runouts), seed_(seed) {}
+
+const BoardRanking& EquityLeafEstimator::ranking_for(const std::array<Card, 5>& board) const {
+    Bitboard mask = EMPTY_BOARD;
+    for (Card c : board) set_card(mask, c);
+    auto it = rankings_.find(mask);
+    if (it == rankings_.end()) it = rankings_.emplace(mask, rank_hole_combos(board)).first;
+    return it->second;
+}
+
+const EquityLeafEstimator::RunoutSet& EquityLeafEstimator::runouts_for(const GameState& state) const {
+    const Bitboard board_mask = board_mask_of(state);
+    auto it = runouts_.find(board_mask);
+    if (it != runouts_.end()) return it->second;
+
+    RunoutSet set;
+    std::array<Card, 5> board{};
+    const int dealt = state.get_board_cards_dealt();
+    for (int i = 0; i < dealt; ++i) board[i] = state.get_board()[i];
+    const int to_come = 5 - dealt;
+    const Bitboard available = FULL_DECK & ~board_mask;
+    const int remaining = count_set_bits(available);
+    const double total = binomial(remaining, to_come);
+
+    const bool enumerate = max_runouts_ > 0 ? total <= max_runouts_ : to_come <= 2;
+    if (enumerate) {
+        enumerate_runouts(board, dealt, available, set.boards);
+    } else {
+        const int samples = max_runouts_ > 0 ? max_runouts_ : DEFAULT_SAMPLED_RUNOUTS;
+        Rng rng(derive_seed(seed_, board_mask));
+        for (int s = 0; s < samples; ++s) {
+            deal_cards(board_mask, to_come, rng, board.data() + dealt);
+            set.boards.push_back(board);
+        }
+    }
+    // Chaque paire de mains (4 cartes) laisse binomial(remaining - 4, to_come) boards possibles.
+    set.scale = total / (set.boards.size() * binomial(remaining - 4, to_come));
+    return runouts_.emplace(board_mask, std::move(set)).first->second;
+}
+
+void EquityLeafEstimator::leaf_values(const LeafQuery& query, RangeVector& out) const {
+    const GameState& state = query.state;
+    const double stake = std::min(state.get_player_contribution(0), state.get_player_contribution(1));
+    const RunoutSet& runouts = runouts_for(state);
+
+    out.assign(NUM_HOLE_COMBOS, 0.0);
+    RangeVector board_values;
+    for (const auto& board : runouts.boards) {
+        // Les combos bloqués par le runout sont absents du classement : ignorés des deux côtés
+        const BoardRanking& ranking = ranking_for(board);
+        showdown_values(query.opp_reach, ranking.hand_ranks, ranking.sorted_combos, stake, board_values);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) out[h] += board_values[h];
+    }
+    for (double& v : out) v *= runouts.scale;
+}
+
+// -----------------------------------------------------------------------------
+//  BlueprintLeafEstimator
+// -----------------------------------------------------------------------------
+BlueprintLeafEstimator::BlueprintLeafEstimator(const CFREngine& blueprint,
+                                               const ActionAbstraction& action_abstraction,
+                                               int rollout_boards,
+                                               double bias_factor,
+                                               uint64_t seed)
+    : blueprint_(blueprint), action_abstraction_(action_abstraction),
+      rollout_boards_(std::max(1, rollout_boards)), bias_factor_(bias_factor), rng_(seed) {}
+
+void BlueprintLeafEstimator::leaf_values(const LeafQuery& query, RangeVector& out) const {
+    std::array<Card, 5> board = query.state.get_board();
+    const int dealt = query.state.get_board_cards_dealt();
+    const Bitboard board_mask = board_mask_of(query.state);
+    const int remaining = count_set_bits(FULL_DECK & ~board_mask);
+    const double scale = binomial(remaining, 5 - dealt) / (rollout_boards_ * binomial(remaining - 4, 5 - dealt));
+
+    GameState start = query.state; // Nœud de hasard explicite : le board vient du rollout
+    start.clear_private_cards();
+
+    out.assign(NUM_HOLE_COMBOS, 0.0);
+    for (int b = 0; b < rollout_boards_; ++b) {
+        deal_cards(board_mask, 5 - dealt, rng_, board.data() + dealt);
+        const BoardRanking ranking = rank_hole_combos(board);
+
+        std::array<RangeVector, 2> reach;
+        reach[query.player] = make_uniform_range(ranking.board_mask); // Non utilisé pour les valeurs
+        reach[1 - query.player] = query.opp_reach;
+        remove_blocked_combos(reach[1 - query.player], ranking.board_mask);
+
+        std::vector<Action> history = query.action_history;
+        const RangeVector values = rollout(start, history, query, reach, ranking);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (ranking.hand_ranks[h] != INVALID_HAND_RANK) out[h] += values[h];
+        }
+    }
+    for (double& v : out) v *= scale;
+}
+
+RangeVector BlueprintLeafEstimator::rollout(GameState state, std::vector<Action>& action_history, const LeafQuery& query,
+                                            const std::array<RangeVector, 2>& reach, const BoardRanking& ranking) const {
+    while (state.is_chance_node()) state.deal_board_card(ranking.board[state.get_board_cards_dealt()]);
+
+    RangeVector values(NUM_HOLE_COMBOS, 0.0);
+    if (state.is_terminal()) {
+        heads_up_terminal_values(state, query.player, reach[1 - query.player], ranking, values);
+        return values;
+    }
+
+    const int acting_player = state.get_current_player();
+    const std::vector<Action> legal_actions = state.get_legal_abstract_actions(action_abstraction_);
+    if (legal_actions.empty()) return values;
+    const size_t num_actions = legal_actions.size();
+
+    const std::string key_prefix = "P" + std::to_string(acting_player) + ";";
+    const std::string key_suffix = public_key_suffix(state, acting_player, action_history);
+    const auto& hole_strings = hole_combo_strings();
+    const bool biased = acting_player == query.chooser && query.continuation > 0;
+
+    std::vector<double> strategies(NUM_HOLE_COMBOS * num_actions, 0.0);
+    std::vector<double> strategy;
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (ranking.hand_ranks[h] == INVALID_HAND_RANK || reach[acting_player][h] == 0.0) continue;
+        blueprint_strategy(key_prefix + hole_strings[h] + key_suffix, legal_actions, biased, query.continuation, strategy);
+        std::copy(strategy.begin(), strategy.end(), strategies.begin() + h * num_actions);
+    }
+
+    std::array<RangeVector, 2> child_reach = reach;
+    for (size_t a = 0; a < num_actions; ++a) {
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            child_reach[acting_player][h] = reach[acting_player][h] * strategies[h * num_actions + a];
+        }
+        GameState next_state = state;
+        next_state.apply_action(legal_actions[a]);
+        action_history.push_back(legal_actions[a]);
+        const RangeVector child = rollout(next_state, action_history, query, child_reach, ranking);
+        action_history.pop_back();
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            // Nœud adverse : valeurs déjà pondérées par la range de chaque branche
+            values[h] += acting_player == query.player ? strategies[h * num_actions + a] * child[h] : child[h];
+        }
+    }
+    return values;
+}
+
+void BlueprintLeafEstimator::blueprint_strategy(const std::string& infoset_key, const std::vector<Action>& actions,
+                                                bool biased, int continuation, std::vector<double>& out) const {
+    const size_t num_actions = actions.size();
+    out.assign(num_actions, 1.0 / num_actions);
+    const InformationSetMap& infosets = blueprint_.get_infoset_map();
+    auto it = infosets.find(infoset_key);
+    if (it != infosets.end() && it->second.num_actions() == num_actions) {
+        double sum = 0.0;
+        for (size_t a = 0; a < num_actions; ++a) sum += it->second.get_strategy_sum(a);
+        if (sum > 0.0) {
+            for (size_t a = 0; a < num_actions; ++a) out[a] = it->second.get_strategy_sum(a) / sum;
+        }
+    }
+    if (!biased) return;
+
+    // Continuations 1, 2, 3 : fold, call, raise favorisés
+    const ActionType favoured = continuation == 1 ? ActionType::FOLD
+                              : continuation == 2 ? ActionType::CALL : ActionType::RAISE;
+    double sum = 0.0;
+    for (size_t a = 0; a < num_actions; ++a) {
+        if (actions[a].type == favoured) out[a] *= bias_factor_;
+        sum += out[a];
+    }
+    if (sum > 0.0) {
+        for (double& p : out) p /= sum;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  SubgameSolver
+// -----------------------------------------------------------------------------
+SubgameSolver::SubgameSolver(const ActionAbstraction& action_abstraction,
+                             const LeafValueEstimator& leaf_estimator,
+                             const SubgameSolverConfig& config)
+    : action_abstraction_(action_abstraction), leaf_estimator_(leaf_estimator), config_(config) {}
+
+void SubgameSolver::build(const GameState& root_state,
+                          const std::vector<Action>& action_history,
+                          const std::array<RangeVector, 2>& ranges) {
+    if (root_state.get_num_players() != 2) {
+        throw std::invalid_argument("SubgameSolver: seul le heads-up est supporté");
+    }
+    if (root_state.is_terminal() || root_state.is_chance_node() || root_state.get_current_player() < 0) {
+        throw std::invalid_argument("SubgameSolver: la racine doit être un nœud de décision");
+    }
+    for (const auto& range : ranges) {
+        if (range.size() != NUM_HOLE_COMBOS) throw std::invalid_argument("SubgameSolver: range de taille invalide");
+    }
+
+    nodes_.clear();
+    leaves_.clear();
+    rankings_.clear();
+    ranking_index_.clear();
+    regrets_.clear();
+    strategy_sums_.clear();
+
+    GameState root = root_state;
+    root.clear_private_cards();
+    root.set_explicit_chance_nodes(true);
+    leaf_chooser_ = config_.leaf_chooser >= 0 ? config_.leaf_chooser : 1 - root.get_current_player();
+
+    const Bitboard board_mask = board_mask_of(root);
+    root_ranges_ = ranges;
+    for (auto& range : root_ranges_) remove_blocked_combos(range, board_mask);
+
+    std::vector<Action> history = action_history;
+    build_node(root, history, root.get_current_street());
+    regrets_.shrink_to_fit();
+    strategy_sums_.shrink_to_fit();
+    built_ = true;
+
+    SPDLOG_DEBUG("SubgameSolver: {} nœuds, {} feuilles, {} classements de board",
+                 nodes_.size(), leaves_.size(), rankings_.size());
+}
+
+int SubgameSolver::add_decision_node(int player, std::vector<Action> actions, std::string key_suffix) {
+    Node node;
+    node.type = NodeType::DECISION;
+    node.player = player;
+    node.actions = std::move(actions);
+    node.key_suffix = std::move(key_suffix);
+    nodes_.push_back(std::move(node));
+    return static_cast<int>(nodes_.size()) - 1;
+}
+
+int SubgameSolver::build_node(const GameState& state, std::vector<Action>& history, Street root_street) {
+    const int node_id = static_cast<int>(nodes_.size());
+
+    if (state.is_chance_node()) {
+        const int streets_ahead = static_cast<int>(state.get_current_street()) - static_cast<int>(root_street);
+        const bool all_in = betting_is_over(state);
+        if (all_in || streets_ahead > config_.max_street_depth) {
+            leaves_.push_back({state, history});
+            const int leaf = static_cast<int>(leaves_.size()) - 1;
+            const int continuations = all_in ? 1 : leaf_estimator_.num_continuations();
+            if (continuations == 1) {
+                Node node;
+                node.type = all_in ? NodeType::ALL_IN : NodeType::LEAF;
+                node.leaf = leaf;
+                nodes_.push_back(std::move(node));
+                return node_id;
+            }
+            // Choix de la continuation par le chooser (une "action" par continuation)
+            add_decision_node(leaf_chooser_, {}, {});
+            nodes_[node_id].board_mask = board_mask_of(state);
+            std::vector<int> children;
+            for (int c = 0; c < continuations; ++c) {
+                Node child;
+                child.type = NodeType::LEAF;
+                child.leaf = leaf;
+                child.continuation = c;
+                nodes_.push_back(std::move(child));
+                children.push_back(static_cast<int>(nodes_.size()) - 1);
+            }
+            nodes_[node_id].children = std::move(children);
+            nodes_[node_id].offset = regrets_.size();
+            regrets_.resize(regrets_.size() + NUM_HOLE_COMBOS * continuations, 0.0);
+            strategy_sums_.resize(regrets_.size(), 0.0);
+            return node_id;
+        }
+
+        Node node;
+        node.type = NodeType::CHANCE;
+        const Bitboard available = state.get_remaining_deck_mask();
+        // Pour deux mains données, 4 cartes de moins sont possibles
+        node.chance_weight = 1.0 / (count_set_bits(available) - 4);
+        nodes_.push_back(std::move(node));
+
+        std::vector<int> children;
+        std::vector<Card> cards;
+        Bitboard remaining = available;
+        while (remaining) {
+            const Card c = pop_lsb(remaining);
+            GameState next_state = state;
+            next_state.deal_board_card(c);
+            cards.push_back(c);
+            children.push_back(build_node(next_state, history, root_street));
+        }
+        nodes_[node_id].children = std::move(children);
+        nodes_[node_id].chance_cards = std::move(cards);
+        return node_id;
+    }
+
+    if (state.is_terminal()) {
+        Node node;
+        node.contributions = {state.get_player_contribution(0), state.get_player_contribution(1)};
+        if (state.is_player_folded(0) || state.is_player_folded(1)) {
+            node.type = NodeType::FOLD;
+            node.folded_player = state.is_player_folded(0) ? 0 : 1;
+        } else {
+            node.type = NodeType::SHOWDOWN;
+            const Bitboard board_mask = board_mask_of(state);
+            auto it = ranking_index_.find(board_mask);
+            if (it == ranking_index_.end()) {
+                rankings_.push_back(rank_hole_combos(state.get_board()));
+                it = ranking_index_.emplace(board_mask, static_cast<int>(rankings_.size()) - 1).first;
+            }
+            node.ranking = it->second;
+        }
+        nodes_.push_back(std::move(node));
+        return node_id;
+    }
+
+    const int player = state.get_current_player();
+    std::vector<Action> legal_actions = state.get_legal_abstract_actions(action_abstraction_);
+    if (legal_actions.empty()) {
+        throw std::logic_error("SubgameSolver: aucune action légale pour un nœud non terminal");
+    }
+    add_decision_node(player, legal_actions, public_key_suffix(state, player, history));
+    nodes_[node_id].board_mask = board_mask_of(state);
+    nodes_[node_id].offset = regrets_.size();
+    regrets_.resize(regrets_.size() + NUM_HOLE_COMBOS * legal_actions.size(), 0.0);
+    strategy_sums_.resize(regrets_.size(), 0.0);
+
+    std::vector<int> children;
+    for (const Action& action : legal_actions) {
+        GameState next_state = state;
+        next_state.apply_action(action);
+        history.push_back(action);
+        children.push_back(build_node(next_state, history, root_street));
+        history.pop_back();
+    }
+    nodes_[node_id].children = std::move(children);
+    return node_id;
+}
+
+size_t SubgameSolver::warm_start(const InformationSetMap& infosets, double iterations_equivalent) {
+    if (!built_) throw std::logic_error("SubgameSolver::warm_start: build() doit être appelé avant");
+    const auto& combos = all_hole_combos();
+    const auto& hole_strings = hole_combo_strings();
+    std::array<double, 2> range_mass{};
+    for (int p = 0; p < 2; ++p) range_mass[p] = std::accumulate(root_ranges_[p].begin(), root_ranges_[p].end(), 0.0);
+
+    size_t initialized = 0;
+    for (const Node& node : nodes_) {
+        if (node.type != NodeType::DECISION || node.actions.empty()) continue; // Choix de continuation : hors blueprint
+        const size_t num_actions = node.children.size();
+        const std::string key_prefix = "P" + std::to_string(node.player) + ";";
+        // Regrets blueprint : pondérés par une probabilité d'atteinte adverse (masse 1)
+        const double regret_scale = iterations_equivalent * range_mass[1 - node.player];
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (combos[h].mask() & node.board_mask) continue;
+            auto it = infosets.find(key_prefix + hole_strings[h] + node.key_suffix);
+            if (it == infosets.end() || it->second.num_actions() != num_actions) continue;
+            const InformationSet& infoset = it->second;
+
+            double* regrets = regrets_.data() + node.offset + h * num_actions;
+            double* sums = strategy_sums_.data() + node.offset + h * num_actions;
+            const double visits = std::max(1, infoset.visit_count);
+            double strategy_total = 0.0;
+            for (size_t a = 0; a < num_actions; ++a) strategy_total += infoset.get_strategy_sum(a);
+            for (size_t a = 0; a < num_actions; ++a) {
+                regrets[a] = regret_scale * infoset.get_regret(a) / visits;
+                if (config_.regret_matching_plus) regrets[a] = std::max(0.0, regrets[a]);
+                if (strategy_total > 0.0) {
+                    sums[a] = iterations_equivalent * root_ranges_[node.player][h] * infoset.get_strategy_sum(a) / strategy_total;
+                }
+            }
+            initialized++;
+        }
+    }
+    SPDLOG_DEBUG("SubgameSolver: warm-start de {} (nœud, main)", initialized);
+    return initialized;
+}
+
+SubgameSolveResult SubgameSolver::solve() {
+    if (!built_) throw std::logic_error("SubgameSolver::solve: build() doit être appelé avant");
+    if (config_.max_iterations <= 0 && config_.max_seconds <= 0.0) {
+        throw std::invalid_argument("SubgameSolver::solve: aucun budget (itérations ou temps)");
+    }
+
+    SubgameSolveResult result;
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = [&]() { return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(); };
+    while ((config_.max_iterations <= 0 || result.iterations < config_.max_iterations) &&
+           (config_.max_seconds <= 0.0 || elapsed() < config_.max_seconds)) {
+        for (int update_player = 0; update_player < 2; ++update_player) {
+            traverse(0, update_player, root_ranges_, result.iterations);
+        }
+        result.iterations++;
+    }
+
+    result.elapsed_seconds = elapsed();
+    for (const Node& node : nodes_) {
+        if (node.type == NodeType::DECISION) result.decision_nodes++;
+        if (node.type == NodeType::LEAF || node.type == NodeType::ALL_IN) result.leaf_nodes++;
+    }
+    result.storage_bytes = (regrets_.size() + strategy_sums_.size()) * sizeof(double);
+    spdlog::info("SubgameSolver: {} itérations en {:.3f}s ({} nœuds de décision, {} feuilles, {:.1f} Mo)",
+                 result.iterations, result.elapsed_seconds, result.decision_nodes, result.leaf_nodes,
+                 result.storage_bytes / (1024.0 * 1024.0));
+    return result;
+}
+
+void SubgameSolver::current_strategy(const Node& node, int combo, double* out) const {
+    const size_t num_actions = node.children.size();
+    const double* regrets = regrets_.data() + node.offset + combo * num_actions;
+    double positive_sum = 0.0;
+    for (size_t a = 0; a < num_actions; ++a) positive_sum += std::max(0.0, regrets[a]);
+    for (size_t a = 0; a < num_actions; ++a) {
+        out[a] = positive_sum > 0.0 ? std::max(0.0, regrets[a]) / positive_sum : 1.0 / num_actions;
+    }
+}
+
+RangeVector SubgameSolver::traverse(int node_id, int update_player, const std::array<RangeVector, 2>& reach, int iteration) {
+    const Node& node = nodes_[node_id];
+    const int opponent = 1 - update_player;
+    RangeVector values(NUM_HOLE_COMBOS, 0.0);
+
+    switch (node.type) {
+    case NodeType::FOLD: {
+        const double payoff = node.folded_player == update_player ? -node.contributions[update_player]
+                                                                  : node.contributions[node.folded_player];
+        fold_values(reach[opponent], payoff, values);
+        return values;
+    }
+    case NodeType::SHOWDOWN: {
+        const BoardRanking& ranking = rankings_[node.ranking];
+        const double stake = std::min(node.contributions[0], node.contributions[1]);
+        showdown_values(reach[opponent], ranking.hand_ranks, ranking.sorted_combos, stake, values);
+        return values;
+    }
+    case NodeType::LEAF:
+    case NodeType::ALL_IN: {
+        const LeafData& leaf = leaves_[node.leaf];
+        const LeafQuery query{leaf.state, leaf.action_history, leaf_chooser_, node.continuation, update_player, reach[opponent]};
+        if (node.type == NodeType::ALL_IN) all_in_estimator_.leaf_values(query, values);
+        else leaf_estimator_.leaf_values(query, values);
+        return values;
+    }
+    case NodeType::CHANCE: {
+        const auto& by_card = combos_by_card();
+        const auto& combos = all_hole_combos();
+        std::array<RangeVector, 2> child_reach = reach;
+        for (size_t i = 0; i < node.children.size(); ++i) {
+            const Card card = node.chance_cards[i];
+            // Mains contenant la carte : impossibles dans ce sous-arbre
+            for (int h : by_card[card]) child_reach[0][h] = child_reach[1][h] = 0.0;
+            const RangeVector child = traverse(node.children[i], update_player, child_reach, iteration);
+            const Bitboard card_mask = 1ULL << card;
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+                if (!(combos[h].mask() & card_mask)) values[h] += node.chance_weight * child[h];
+            }
+            for (int h : by_card[card]) {
+                child_reach[0][h] = reach[0][h];
+                child_reach[1][h] = reach[1][h];
+            }
+        }
+        return values;
+    }
+    case NodeType::DECISION:
+        break;
+    }
+
+    const int acting_player = node.player;
+    const size_t num_actions = node.children.size();
+    const RangeVector& acting_reach = reach[acting_player];
+    const auto& combos = all_hole_combos();
+
+    std::vector<double> strategies(NUM_HOLE_COMBOS * num_actions, 0.0);
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (combos[h].mask() & node.board_mask) continue;
+        if (acting_player != update_player && acting_reach[h] == 0.0) continue;
+        current_strategy(node, h, strategies.data() + h * num_actions);
+    }
+
+    std::vector<RangeVector> action_values(acting_player == update_player ? num_actions : 0);
+    std::array<RangeVector, 2> child_reach = reach;
+    for (size_t a = 0; a < num_actions; ++a) {
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            child_reach[acting_player][h] = acting_reach[h] * strategies[h * num_actions + a];
+        }
+        RangeVector child = traverse(node.children[a], update_player, child_reach, iteration);
+        if (acting_player == update_player) {
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += strategies[h * num_actions + a] * child[h];
+            action_values[a] = std::move(child);
+        } else {
+            for (int h = 0; h < NUM_HOLE_COMBOS; ++h) values[h] += child[h];
+        }
+    }
+
+    if (acting_player == update_player) {
+        // RM+ : moyenne pondérée linéairement par l'itération
+        const double average_weight = config_.regret_matching_plus ? iteration + 1.0 : 1.0;
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (combos[h].mask() & node.board_mask) continue;
+            double* regrets = regrets_.data() + node.offset + h * num_actions;
+            double* sums = strategy_sums_.data() + node.offset + h * num_actions;
+            for (size_t a = 0; a < num_actions; ++a) {
+                regrets[a] += action_values[a][h] - values[h];
+                if (config_.regret_matching_plus) regrets[a] = std::max(0.0, regrets[a]);
+                sums[a] += average_weight * acting_reach[h] * strategies[h * num_actions + a];
+            }
+        }
+    }
+    return values;
+}
+
+const std::vector<Action>& SubgameSolver::get_root_actions() const {
+    if (!built_) throw std::logic_error("SubgameSolver: build() doit être appelé avant");
+    return nodes_[0].actions;
+}
+
+int SubgameSolver::get_root_player() const {
+    return built_ ? nodes_[0].player : -1;
+}
+
+std::vector<double> SubgameSolver::get_root_strategy(int combo) const {
+    return get_average_strategy({}, combo);
+}
+
+std::vector<double> SubgameSolver::get_average_strategy(const std::vector<Action>& actions_from_root, int combo) const {
+    if (!built_ || combo < 0 || combo >= NUM_HOLE_COMBOS) return {};
+    int node_id = 0;
+    for (const Action& action : actions_from_root) {
+        const Node& node = nodes_[node_id];
+        if (node.type != NodeType::DECISION) return {};
+        auto it = std::find_if(node.actions.begin(), node.actions.end(), [&](const Action& a) {
+            return a.type == action.type && a.amount == action.amount;
+        });
+        if (it == node.actions.end()) return {};
+        node_id = node.children[it - node.actions.begin()];
+    }
+
+    const Node& node = nodes_[node_id];
+    if (node.type != NodeType::DECISION) return {};
+    const size_t num_actions = node.children.size();
+    std::vector<double> strategy(num_actions, 1.0 / num_actions);
+    const double* sums = strategy_sums_.data() + node.offset + combo * num_actions;
+    double total = 0.0;
+    for (size_t a = 0; a < num_actions; ++a) total += sums[a];
+    if (total > 0.0) {
+        for (size_t a = 0; a < num_actions; ++a) strategy[a] = sums[a] / total;
+    }
+    return strategy;
+}
+
+} // namespace gto_solver
@@ -0,0 +1,171 @@
+#include "gto/training_scheduler.h"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+namespace gto_solver {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double seconds_since(Clock::time_point t) {
+    return std::chrono::duration<double>(Clock::now() - t).count();
+}
+
+} // namespace
+
+std::string stop_reason_to_string(TrainingStopReason reason) {
+    switch (reason) {
+        case TrainingStopReason::ITERATION_BUDGET:      return "ITERATION_BUDGET";
+        case TrainingStopReason::TIME_BUDGET:           return "TIME_BUDGET";
+        case TrainingStopReason::EXPLOITABILITY_TARGET: return "EXPLOITABILITY_TARGET";
+    }
+    return "UNKNOWN";
+}
+
+TrainingScheduler::TrainingScheduler(CFREngine& engine,
+                                     const ActionAbstraction& action_abstraction,
+                                     const TrainingSchedulerConfig& config)
+    : engine_(engine), best_response_(engine, action_abstraction), config_(config) {}
+
+TrainingReport TrainingScheduler::run(const GameState& initial_state) {
+    const TrainingBudget& budget = config_.budget;
+    // Partie hors de portée de la meilleure réponse : pas d'évaluation plutôt qu'une
+    // exploitabilité nulle qui arrêterait l'entraînement sur la cible.
+    bool evaluate = config_.enable_evaluation;
+    if (evaluate && !best_response_.is_supported(initial_state)) {
+        spdlog::warn("TrainingScheduler: évaluation désactivée (meilleure réponse non supportée pour cette partie).");
+        evaluate = false;
+    }
+    const bool target_active = evaluate && budget.target_exploitability_mbb > 0.0;
+    if (budget.target_exploitability_mbb > 0.0 && !evaluate) {
+        spdlog::warn("TrainingScheduler: exploitabilité cible ignorée (évaluation désactivée).");
+    }
+    if (budget.max_seconds <= 0.0 && budget.max_iterations <= 0 && !target_active) {
+        throw std::invalid_argument("TrainingScheduler: aucun critère d'arrêt actif");
+    }
+
+    const auto start = Clock::now();
+    auto last_checkpoint = start;
+    double training_seconds = 0.0;
+    int evaluation_interval = std::max(1, config_.min_iterations_between_evaluations);
+    int next_evaluation_at = evaluation_interval;
+    // Lot de sondage d'une itération pour mesurer la cadence, puis doublement jusqu'à
+    // max_batch_iterations : un budget de temps court n'est pas dépassé par le premier lot.
+    const int max_batch = std::max(1, config_.max_batch_iterations);
+    int batch_size = 1;
+
+    TrainingReport report;
+    TrainingProgress& progress = report.final_progress;
+
+    spdlog::info("TrainingScheduler: démarrage (budget: {}s, {} itérations, cible {} mbb/main).",
+                 budget.max_seconds, budget.max_iterations, budget.target_exploitability_mbb);
+
+    while (true) {
+        progress.elapsed_seconds = seconds_since(start);
+        if (budget.max_iterations > 0 && progress.iterations >= budget.max_iterations) {
+            report.stop_reason = TrainingStopReason::ITERATION_BUDGET;
+            break;
+        }
+        if (budget.max_seconds > 0.0 && progress.elapsed_seconds >= budget.max_seconds) {
+            report.stop_reason = TrainingStopReason::TIME_BUDGET;
+            break;
+        }
+
+        // Taille du lot : jusqu'à la prochaine évaluation, sans dépasser les budgets.
+        int batch = batch_size;
+        batch_size = std::min(max_batch, batch_size * 2);
+        if (budget.max_iterations > 0) batch = std::min(batch, budget.max_iterations - progress.iterations);
+        if (evaluate) batch = std::min(batch, std::max(1, next_evaluation_at - progress.iterations));
+        if (budget.max_seconds > 0.0 && progress.iterations_per_second > 0.0) {
+            const double remaining = budget.max_seconds - progress.elapsed_seconds;
+            batch = std::min(batch, std::max(1, static_cast<int>(remaining * progress.iterations_per_second)));
+        }
+
+        const auto batch_start = Clock::now();
+        engine_.run_iterations(batch, initial_state);
+        training_seconds += seconds_since(batch_start);
+        progress.iterations += batch;
+        progress.iterations_per_second = training_seconds > 0.0 ? progress.iterations / training_seconds : 0.0;
+
+        bool target_reached = false;
+        if (evaluate && progress.iterations >= next_evaluation_at) {
+            const ExploitabilityResult eval = best_response_.compute(
+                initial_state, config_.evaluation_chance_samples, config_.evaluation_threads,
+                static_cast<uint64_t>(progress.evaluations));
+            progress.has_evaluation = true;
+            progress.exploitability_mbb = eval.exploitability_mbb;
+            progress.evaluations++;
+            progress.evaluation_seconds += eval.elapsed_seconds;
+            target_reached = target_active && eval.exploitability_mbb <= budget.target_exploitability_mbb;
+
+            // Intervalle tel que eval / (intervalle * coût_itération + eval) <= fraction cible.
+            const double fraction = std::clamp(config_.max_evaluation_time_fraction, 1e-3, 1.0);
+            if (progress.iterations_per_second > 0.0) {
+                const double seconds_per_iteration = 1.0 / progress.iterations_per_second;
+                const double wanted = eval.elapsed_seconds * (1.0 - fraction) / (fraction * seconds_per_iteration);
+                evaluation_interval = static_cast<int>(std::clamp(std::ceil(wanted),
+                    static_cast<double>(std::max(1, config_.min_iterations_between_evaluations)),
+                    static_cast<double>(std::max(1, config_.max_iterations_between_evaluations))));
+            }
+            next_evaluation_at = progress.iterations + evaluation_interval;
+            spdlog::debug("TrainingScheduler: évaluation en {:.3f}s, prochaine dans {} itérations.",
+                          eval.elapsed_seconds, evaluation_interval);
+        }
+
+        if (!config_.checkpoint_file.empty() &&
+            seconds_since(last_checkpoint) >= config_.checkpoint_interval_seconds) {
+            write_checkpoint(progress);
+            last_checkpoint = Clock::now();
+        }
+
+        if (!config_.metrics_file.empty()) {
+            append_metrics_json_line(config_.metrics_file, engine_.get_metrics());
+        }
+
+        progress.elapsed_seconds = seconds_since(start);
+        spdlog::info("TrainingScheduler: {} itérations, {:.1f}s, {:.1f} it/s{}",
+                     progress.iterations, progress.elapsed_seconds, progress.iterations_per_second,
+                     progress.has_evaluation ? fmt::format(", exploitabilité {:.2f} mbb/main", progress.exploitability_mbb) : "");
+        if (progress_callback_) progress_callback_(progress);
+
+        if (target_reached) {
+            report.stop_reason = TrainingStopReason::EXPLOITABILITY_TARGET;
+            break;
+        }
+    }
+
+    if (!config_.checkpoint_file.empty()) write_checkpoint(progress);
+    progress.elapsed_seconds = seconds_since(start);
+    spdlog::info("TrainingScheduler: arrêt ({}) après {} itérations en {:.1f}s ({} évaluations, {:.1f}s d'évaluation).",
+                 stop_reason_to_string(report.stop_reason), progress.iterations, progress.elapsed_seconds,
+                 progress.evaluations, progress.evaluation_seconds);
+    return report;
+}
+
+bool TrainingScheduler::write_checkpoint(TrainingProgress& progress) {
+    bool ok;
+    if (config_.use_delta_checkpoints && has_full_checkpoint_) {
+        ok = engine_.save_infoset_delta(config_.checkpoint_file + ".delta");
+    } else {
+        ok = engine_.save_infoset_map(config_.checkpoint_file);
+        if (ok) {
+            engine_.clear_dirty_flags();
+            // Nouvelle chaîne de deltas : l'ancienne ne correspond plus à la base.
+            std::remove((config_.checkpoint_file + ".delta").c_str());
+            has_full_checkpoint_ = true;
+        }
+    }
+    if (ok) {
+        progress.checkpoints++;
+    } else {
+        spdlog::error("TrainingScheduler: échec du checkpoint {}.", config_.checkpoint_file);
+    }
+    return ok;
+}
+
+} // namespace gto_solver
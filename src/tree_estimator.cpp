@@ -0,0 +1,262 @@
+#include "gto/tree_estimator.h"
+#include "gto/game_utils.hpp" // Pour street_to_string
+#include "core/bitboard.hpp"
+#include "spdlog/spdlog.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace gto_solver {
+
+StreetTreeStats& StreetTreeStats::operator+=(const StreetTreeStats& other) {
+    decision_nodes += other.decision_nodes;
+    distinct_public_states += other.distinct_public_states;
+    action_slots += other.action_slots;
+    infosets += other.infosets;
+    infoset_action_slots += other.infoset_action_slots;
+    key_heap_bytes += other.key_heap_bytes;
+    return *this;
+}
+
+StreetTreeStats TreeEstimate::total() const {
+    StreetTreeStats sum;
+    for (const StreetTreeStats& street : streets) sum += street;
+    return sum;
+}
+
+size_t infoset_overhead_bytes() {
+    // Nœud de std::unordered_map (suivant + hash mis en cache), un bucket par entrée
+    // (facteur de charge 1), en-tête malloc du tableau de regrets/stratégie.
+    return sizeof(std::pair<const std::string, InformationSet>) + 3 * sizeof(void*) + 16;
+}
+
+double TreeEstimate::projected_bytes(const StoragePrecision& precision) const {
+    const StreetTreeStats sum = total();
+    return sum.infosets * static_cast<double>(infoset_overhead_bytes()) +
+           sum.infoset_action_slots * static_cast<double>(precision.bytes_per_action()) + sum.key_heap_bytes;
+}
+
+namespace {
+
+std::string format_bytes(double bytes) {
+    static const char* const UNITS[] = {"o", "Ko", "Mo", "Go", "To", "Po"};
+    size_t unit = 0;
+    while (bytes >= 1024.0 && unit + 1 < std::size(UNITS)) {
+        bytes /= 1024.0;
+        ++unit;
+    }
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(unit == 0 ? 0 : 2) << bytes << " " << UNITS[unit];
+    return ss.str();
+}
+
+double binomial(int n, int k) {
+    double result = 1.0;
+    for (int i = 1; i <= k; ++i) result = result * (n - k + i) / i;
+    return result;
+}
+
+// Infosets par nœud public : boards de k cartes, puis mains privées compatibles.
+double card_multiplicity(int board_cards) {
+    return binomial(NUM_CARDS, board_cards) * binomial(NUM_CARDS - board_cards, 2);
+}
+
+struct WalkStats {
+    std::array<StreetTreeStats, 4> streets;
+    long long terminal_nodes = 0;
+    long long chance_nodes = 0;
+    std::array<std::unordered_set<uint64_t>, 4> public_states; // Si count_transpositions
+
+    void merge_into(TreeEstimate& estimate, std::array<std::unordered_set<uint64_t>, 4>& all_public_states) {
+        for (size_t s = 0; s < streets.size(); ++s) {
+            estimate.streets[s] += streets[s];
+            all_public_states[s].merge(public_states[s]);
+        }
+        estimate.terminal_nodes += terminal_nodes;
+        estimate.chance_nodes += chance_nodes;
+    }
+};
+
+int decimal_digits(int value) {
+    int digits = value < 0 ? 2 : 1;
+    for (value = value < 0 ? -value : value; value >= 10; value /= 10) ++digits;
+    return digits;
+}
+
+// Caractères ajoutés par une action à l'historique d'une clé d'infoset
+// (format de InformationSet::generate_key : "A<joueur><F|C|R><montant>,").
+size_t history_key_chars(const Action& action) {
+    return 3 + decimal_digits(action.player_index) + decimal_digits(action.amount);
+}
+
+// Nœud public à visiter : état (cartes privées retirées) et longueur de l'historique dans les clés.
+struct PendingNode {
+    GameState state;
+    size_t history_chars = 0;
+};
+
+class TreeWalker {
+public:
+    TreeWalker(const ActionAbstraction& action_abstraction, const TreeEstimatorConfig& config,
+               std::atomic<long long>& visited, std::atomic<bool>& truncated)
+        : action_abstraction_(action_abstraction), config_(config), visited_(visited), truncated_(truncated) {}
+
+    // Compte le nœud ; remplit actions (vide si terminal ou budget épuisé). Les nœuds de
+    // hasard sont résolus sur place (carte quelconque : les actions n'en dépendent pas).
+    void visit(GameState& state, size_t history_chars, WalkStats& stats, std::vector<Action>& actions) {
+        actions.clear();
+        while (state.is_chance_node()) {
+            stats.chance_nodes++;
+            state.deal_board_card(select_nth_card(state.get_remaining_deck_mask(), 0));
+        }
+        if (config_.max_public_nodes > 0 && visited_.fetch_add(1, std::memory_order_relaxed) >= config_.max_public_nodes) {
+            truncated_.store(true, std::memory_order_relaxed);
+            return;
+        }
+        if (state.is_terminal()) {
+            stats.terminal_nodes++;
+            return;
+        }
+        action_abstraction_.get_abstract_actions(state, actions);
+        const int board_cards = state.get_board_cards_dealt();
+        const size_t street_index = std::min<size_t>(static_cast<size_t>(state.get_current_street()), 3);
+        StreetTreeStats& street = stats.streets[street_index];
+        if (config_.count_transpositions) stats.public_states[street_index].insert(state.public_state_hash());
+        const double multiplicity = card_multiplicity(board_cards);
+        street.decision_nodes++;
+        street.action_slots += static_cast<long long>(actions.size());
+        street.infosets += multiplicity;
+        street.infoset_action_slots += multiplicity * static_cast<double>(actions.size());
+
+        // Longueur exacte des clés de ce nœud (mêmes pour toutes les mains et tous les boards)
+        const size_t key_length = key_prefix_length(state) + history_chars;
+        if (key_length > SSO_CAPACITY) street.key_heap_bytes += multiplicity * static_cast<double>(key_length + 1);
+    }
+
+    void walk(GameState state, size_t history_chars, WalkStats& stats) {
+        if (truncated_.load(std::memory_order_relaxed)) return;
+        std::vector<Action> actions;
+        visit(state, history_chars, stats, actions);
+        for (const Action& action : actions) {
+            GameState next_state = state;
+            next_state.apply_action(action);
+            walk(std::move(next_state), history_chars + history_key_chars(action), stats);
+        }
+    }
+
+private:
+    inline static const size_t SSO_CAPACITY = std::string().capacity();
+
+    // Longueur de la clé sans historique : ne dépend que du joueur, de la street et du nombre de cartes de board
+    size_t key_prefix_length(const GameState& state) const {
+        static const std::vector<Card> DUMMY_HOLE = {0, 1};
+        return InformationSet::generate_key(state.get_current_player(), DUMMY_HOLE, state.get_board(),
+                                            state.get_board_cards_dealt(), state.get_current_street(), {}).size();
+    }
+
+    const ActionAbstraction& action_abstraction_;
+    const TreeEstimatorConfig& config_;
+    std::atomic<long long>& visited_;
+    std::atomic<bool>& truncated_;
+};
+
+} // namespace
+
+TreeEstimate estimate_tree_size(const GameState& root, const ActionAbstraction& action_abstraction,
+                                const TreeEstimatorConfig& config) {
+    const auto start_time = std::chrono::steady_clock::now();
+    const int num_threads = config.threads > 0 ? config.threads
+                                               : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<long long> visited{0};
+    std::atomic<bool> truncated{false};
+    TreeWalker walker(action_abstraction, config, visited, truncated);
+    TreeEstimate estimate;
+
+    GameState root_state = root;
+    root_state.clear_private_cards();
+    root_state.set_explicit_chance_nodes(true);
+
+    // Parcours en largeur jusqu'à une frontière assez large pour répartir les sous-arbres
+    WalkStats root_stats;
+    std::vector<PendingNode> frontier{{root_state, 0}};
+    const size_t target = static_cast<size_t>(num_threads) * 16;
+    std::vector<Action> actions;
+    while (num_threads > 1 && !frontier.empty() && frontier.size() < target) {
+        std::vector<PendingNode> next_level;
+        for (PendingNode& node : frontier) {
+            walker.visit(node.state, node.history_chars, root_stats, actions);
+            for (const Action& action : actions) {
+                PendingNode child{node.state, node.history_chars + history_key_chars(action)};
+                child.state.apply_action(action);
+                next_level.push_back(std::move(child));
+            }
+        }
+        frontier = std::move(next_level);
+    }
+    std::array<std::unordered_set<uint64_t>, 4> public_states;
+    root_stats.merge_into(estimate, public_states);
+
+    // Sous-arbres de la frontière répartis dynamiquement entre les threads
+    std::vector<WalkStats> worker_stats(std::max(1, num_threads));
+    std::atomic<size_t> next_node{0};
+    auto worker = [&](int w) {
+        for (size_t i = next_node++; i < frontier.size(); i = next_node++) {
+            walker.walk(frontier[i].state, frontier[i].history_chars, worker_stats[w]);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int w = 1; w < num_threads; ++w) threads.emplace_back(worker, w);
+    worker(0);
+    for (auto& t : threads) t.join();
+    for (WalkStats& stats : worker_stats) stats.merge_into(estimate, public_states);
+    for (size_t s = 0; s < public_states.size(); ++s) {
+        estimate.streets[s].distinct_public_states = static_cast<long long>(public_states[s].size());
+    }
+
+    estimate.truncated = truncated.load();
+    estimate.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    if (estimate.truncated) {
+        spdlog::warn("estimate_tree_size: limite de {} nœuds publics atteinte, estimation partielle", config.max_public_nodes);
+    }
+    return estimate;
+}
+
+std::string TreeEstimate::report() const {
+    std::ostringstream ss;
+    ss << std::setprecision(4);
+    ss << "Arbre de mises" << (truncated ? " (partiel : limite de nœuds atteinte)" : "") << ", parcouru en "
+       << seconds << " s\n";
+    for (size_t s = 0; s < streets.size(); ++s) {
+        const StreetTreeStats& street = streets[s];
+        ss << "  " << std::left << std::setw(8) << street_to_string(static_cast<Street>(s)) << std::right
+           << " nœuds=" << street.decision_nodes;
+        if (street.distinct_public_states > 0) ss << " (distincts=" << street.distinct_public_states << ")";
+        ss << " slots=" << street.action_slots
+           << " infosets=" << street.infosets << " slots d'infosets=" << street.infoset_action_slots << "\n";
+    }
+    const StreetTreeStats sum = total();
+    ss << "  Total    nœuds=" << sum.decision_nodes << " slots=" << sum.action_slots << " infosets=" << sum.infosets
+       << " terminaux=" << terminal_nodes << " hasard=" << chance_nodes << "\n";
+    ss << "Mémoire projetée (regrets / stratégie cumulée) :\n";
+    const std::pair<RegretStorage, const char*> regret_modes[] = {
+        {RegretStorage::DOUBLE, "double"}, {RegretStorage::INT32_SCALED, "int32"}};
+    const std::pair<StrategyStorage, const char*> strategy_modes[] = {
+        {StrategyStorage::DOUBLE, "double"}, {StrategyStorage::FLOAT32, "float32"}, {StrategyStorage::FLOAT16, "float16"}};
+    for (const auto& [regrets, regret_name] : regret_modes) {
+        for (const auto& [strategy, strategy_name] : strategy_modes) {
+            StoragePrecision precision;
+            precision.regrets = regrets;
+            precision.strategy = strategy;
+            ss << "  " << regret_name << " / " << strategy_name << " : " << format_bytes(projected_bytes(precision)) << "\n";
+        }
+    }
+    return ss.str();
+}
+
+} // namespace gto_solver
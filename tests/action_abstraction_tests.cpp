@@ -2,6 +2,7 @@
 // ──────────────────────────────────────────────────────────────────────────────
 #include "gto/action_abstraction.h"
 #include "gto/game_state.h"
+#include "core/ini_file.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp>
@@ -454,3 +455,94 @@ TEST_CASE("Default Action Abstraction - No Folds", "[ActionAbstraction]")
     // REQUIRE(has_action_type_amount(actions, ActionType::RAISE, 6)); // Plus valide
     // REQUIRE_FALSE(has_action_type_amount(actions, ActionType::RAISE, 3)); // Toujours vrai
 }
+
+// ──────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ActionAbstraction compiled generator", "[action_abstraction]")
+{
+    GameState state(2, /*stack=*/100, /*ante=*/0, /*button_pos=*/0, BIG_BLIND_SIZE_INT);
+    // Pot 3, SB à 1 face à 2 : pot si call = 4. 0,5 pot -> 4 (min raise), 3 BB -> 6, exact 6 -> 6
+    ActionAbstraction abs(true, true,
+                          {{Street::PREFLOP, {0.5, 1.0, -1.0}}},
+                          {{Street::PREFLOP, {3.0}}},
+                          {{Street::PREFLOP, {6, 200}}}, true);
+    REQUIRE(abs.max_actions() == 2 + 5 + 1); // La fraction négative est écartée
+
+    SECTION("Raises are sorted by amount and deduplicated in place")
+    {
+        std::vector<Action> buffer(abs.max_actions());
+        const size_t count = abs.get_abstract_actions(state, std::span<Action>(buffer));
+        buffer.resize(count);
+        REQUIRE(buffer == abs.get_abstract_actions(state));
+
+        std::vector<int> raises;
+        for (const Action& a : buffer) if (a.type == ActionType::RAISE) raises.push_back(a.amount);
+        REQUIRE(raises == std::vector<int>{4, 6, 100}); // 1 pot -> 6 ; exact 200 -> all-in
+        REQUIRE(buffer[0].type == ActionType::FOLD);
+        REQUIRE(buffer[1].type == ActionType::CALL);
+    }
+
+    SECTION("Buffers smaller than max_actions are rejected")
+    {
+        std::vector<Action> buffer(abs.max_actions() - 1);
+        REQUIRE_THROWS_AS(abs.get_abstract_actions(state, std::span<Action>(buffer)), std::invalid_argument);
+    }
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ActionAbstraction per-raise-level sizing from INI", "[action_abstraction]")
+{
+    // Ouverture : 3 tailles ; 3-bet : pot ; au-delà : all-in seul, 3 relances max
+    IniFile ini = IniFile::parse_string(R"(
+        [abstraction]
+        allow_all_in = true
+        [preflop]
+        bb_sizes = 2.5, 3, 4
+        max_raises = 3
+        [preflop.raise1]
+        pot_fractions = 1.0
+        [preflop.raise2]
+        pot_fractions =
+        [solver]            ; Section d'un autre composant : ignorée
+        iterations = 10
+    )");
+    GameState state(2, /*stack=*/100, /*ante=*/0, /*button_pos=*/0, BIG_BLIND_SIZE_INT);
+    auto raise_amounts = [](const ActionAbstraction& abs, const GameState& s) {
+        std::vector<int> raises;
+        for (const Action& a : abs.get_abstract_actions(s)) if (a.type == ActionType::RAISE) raises.push_back(a.amount);
+        return raises;
+    };
+
+    const ActionAbstraction abs = ActionAbstraction::from_ini(ini);
+    REQUIRE(raise_amounts(abs, state) == std::vector<int>{5, 6, 8, 100});
+
+    state.apply_action({state.get_current_player(), ActionType::RAISE, 6});
+    REQUIRE(state.get_street_raise_count() == 1);
+    // Pot 8, 4 à payer : relance au pot -> 6 + 12
+    REQUIRE(raise_amounts(abs, state) == std::vector<int>{18, 100});
+
+    state.apply_action({state.get_current_player(), ActionType::RAISE, 18});
+    REQUIRE(raise_amounts(abs, state) == std::vector<int>{100});
+
+    SECTION("Raise cap removes every raise")
+    {
+        ini.set("preflop", "max_raises", "2");
+        const ActionAbstraction capped = ActionAbstraction::from_ini(ini);
+        REQUIRE(raise_amounts(capped, state).empty());
+        REQUIRE(capped.get_abstract_actions(state).size() == 2); // Fold, call
+    }
+
+    SECTION("Raise count restarts on each street")
+    {
+        state.apply_action({state.get_current_player(), ActionType::CALL, 18});
+        REQUIRE(state.get_current_street() == Street::FLOP);
+        REQUIRE(state.get_street_raise_count() == 0);
+    }
+
+    SECTION("Unknown keys and malformed level sections are rejected")
+    {
+        REQUIRE_THROWS_AS(ActionAbstraction::from_ini(IniFile::parse_string("[flop]\npot_fraction = 0.5\n")),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(ActionAbstraction::from_ini(IniFile::parse_string("[flop.raise0]\npot_fractions = 1\n")),
+                          std::invalid_argument);
+    }
+}
@@ -0,0 +1,76 @@
+#include "gto/action_translation.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <stdexcept>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+// Flop après un limp heads-up : pot 4, aucune mise, P1 agit
+GameState make_flop_state(const ActionAbstraction& abstraction) {
+    GameState state(2, /*stack=*/100, /*ante=*/0, /*button_pos=*/0, /*bb=*/2);
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == ActionType::CALL) {
+            state.apply_action(action);
+            break;
+        }
+    }
+    return state;
+}
+
+} // namespace
+
+TEST_CASE("Pseudo-harmonic mapping", "[ActionTranslation]") {
+    REQUIRE(pseudo_harmonic_probability(0.5, 1.0, 0.5) == 1.0);
+    REQUIRE(pseudo_harmonic_probability(0.5, 1.0, 1.0) == 0.0);
+    REQUIRE(pseudo_harmonic_probability(0.5, 1.0, 0.75) == Catch::Approx(3.0 / 7.0));
+    double previous = 1.0;
+    for (double x = 0.5; x <= 1.0; x += 0.05) {
+        const double f = pseudo_harmonic_probability(0.5, 1.0, x);
+        REQUIRE(f <= previous);
+        previous = f;
+    }
+}
+
+TEST_CASE("Action translator maps off-tree bets to neighbouring sizes", "[ActionTranslation]") {
+    ActionAbstraction abstraction(true, true, {{Street::FLOP, {0.5, 1.0}}});
+    const GameState flop = make_flop_state(abstraction);
+    REQUIRE(flop.get_current_street() == Street::FLOP);
+    const int player = flop.get_current_player();
+    const std::vector<Action> legal_actions = flop.get_legal_abstract_actions(abstraction);
+    REQUIRE(legal_actions.size() == 4); // check, 2, 4, all-in
+    REQUIRE(raise_pot_fraction(flop, 4) == Catch::Approx(1.0));
+
+    const TranslationTable table(flop, legal_actions);
+    const TranslatedAction in_tree = table.translate({player, ActionType::RAISE, 4});
+    REQUIRE(in_tree.lower == in_tree.upper);
+    REQUIRE(legal_actions[in_tree.lower].amount == 4);
+
+    const TranslatedAction off_tree = table.translate({player, ActionType::RAISE, 3});
+    REQUIRE(legal_actions[off_tree.lower].amount == 2);
+    REQUIRE(legal_actions[off_tree.upper].amount == 4);
+    REQUIRE(off_tree.lower_probability == Catch::Approx(3.0 / 7.0));
+    REQUIRE(off_tree.probability(off_tree.lower) + off_tree.probability(off_tree.upper) == Catch::Approx(1.0));
+
+    // Hors bornes : taille abstraite la plus proche
+    REQUIRE(legal_actions[table.translate({player, ActionType::RAISE, 1}).lower].amount == 2);
+    REQUIRE(legal_actions[table.translate({player, ActionType::CALL, 0}).lower].type == ActionType::CALL);
+    REQUIRE_FALSE(table.translate({player, ActionType::FOLD, 0}).valid()); // Pas de fold sans mise
+
+    Rng rng(11);
+    ActionTranslator deterministic(abstraction, TranslationMode::DETERMINISTIC);
+    REQUIRE(deterministic.map(flop, {player, ActionType::RAISE, 3}, rng).amount == 4);
+    REQUIRE_THROWS_AS(deterministic.map(flop, {player, ActionType::FOLD, 0}, rng), std::invalid_argument);
+
+    ActionTranslator randomized(abstraction);
+    int lower_count = 0;
+    const int samples = 20000;
+    for (int i = 0; i < samples; ++i) {
+        if (randomized.map(flop, {player, ActionType::RAISE, 3}, rng).amount == 2) lower_count++;
+    }
+    REQUIRE(static_cast<double>(lower_count) / samples == Catch::Approx(3.0 / 7.0).margin(0.02));
+}
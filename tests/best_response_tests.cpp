@@ -0,0 +1,175 @@
+#include "gto/best_response.h"
+#include "gto/hand_range.h"
+#include "gto/cfr_engine.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include "gto/information_set.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+void apply(GameState& state, const ActionAbstraction& abstraction, ActionType type) {
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == type) {
+            state.apply_action(action);
+            return;
+        }
+    }
+    throw std::runtime_error("action introuvable");
+}
+
+} // namespace
+
+TEST_CASE("Hand range card removal", "[HandRange]") {
+    const auto& combos = all_hole_combos();
+    REQUIRE(combo_index(combos[100].c2, combos[100].c1) == 100);
+    REQUIRE(combo_index(5, 5) == -1);
+
+    SECTION("Fold values count compatible opponent combos") {
+        RangeVector values;
+        fold_values(make_uniform_range(), 1.0, values);
+        for (double v : values) REQUIRE(v == Catch::Approx(1225.0)); // C(50, 2)
+
+        Bitboard board = EMPTY_BOARD;
+        for (Card c : {0, 13, 26, 39, 51}) set_card(board, c);
+        const RangeVector reach = make_uniform_range(board);
+        fold_values(reach, 2.0, values);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (reach[h] > 0.0) REQUIRE(values[h] == Catch::Approx(2.0 * 990.0)); // C(45, 2)
+        }
+    }
+
+    SECTION("Showdown values match brute force") {
+        // Rangs synthétiques avec beaucoup d'égalités et des combos bloqués
+        std::vector<uint16_t> ranks(NUM_HOLE_COMBOS);
+        RangeVector reach(NUM_HOLE_COMBOS);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            ranks[h] = (h % 7 == 0) ? 0 : static_cast<uint16_t>(1 + (h * 37) % 50);
+            reach[h] = ranks[h] == 0 ? 0.0 : 0.1 + (h % 11) * 0.05;
+        }
+        RangeVector fast;
+        showdown_values(reach, ranks, sort_combos_by_strength(ranks), 3.0, fast);
+
+        for (int h = 0; h < NUM_HOLE_COMBOS; h += 13) {
+            if (ranks[h] == 0) continue;
+            double expected = 0.0;
+            for (int o = 0; o < NUM_HOLE_COMBOS; ++o) {
+                if (ranks[o] == 0 || (combos[h].mask() & combos[o].mask())) continue;
+                if (ranks[h] < ranks[o]) expected += 3.0 * reach[o];
+                else if (ranks[h] > ranks[o]) expected -= 3.0 * reach[o];
+            }
+            REQUIRE(fast[h] == Catch::Approx(expected).margin(1e-9));
+        }
+    }
+}
+
+TEST_CASE("BestResponse exploitability", "[BestResponse]") {
+    ActionAbstraction abstraction; // all-in seulement : arbre minuscule
+    CFREngine engine(abstraction);
+    GameState root(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2);
+    engine.run_iterations(2, root);
+
+    BestResponse best_response(engine, abstraction);
+    const ExploitabilityResult single = best_response.compute(root, 4, /*num_threads=*/1, /*seed=*/7);
+    REQUIRE(single.chance_samples == 4);
+    REQUIRE(std::isfinite(single.exploitability_mbb));
+    // Le jeu est à somme nulle : la somme des meilleures réponses est positive.
+    REQUIRE(single.best_response_values[0] + single.best_response_values[1] >= -1e-9);
+    REQUIRE(single.exploitability_mbb == Catch::Approx(single.exploitability_chips / 2.0 * 1000.0));
+
+    // Même graine : résultat indépendant du nombre de threads
+    const ExploitabilityResult parallel = best_response.compute(root, 4, /*num_threads=*/3, /*seed=*/7);
+    REQUIRE(parallel.best_response_values[0] == single.best_response_values[0]);
+    REQUIRE(parallel.best_response_values[1] == single.best_response_values[1]);
+    REQUIRE(single.supported);
+
+    SECTION("Unsupported games are reported, not scored zero") {
+        const GameState three_handed(3, 20, 0, 0, 2);
+        REQUIRE_FALSE(best_response.is_supported(three_handed));
+        REQUIRE_FALSE(best_response.compute(three_handed, 4, 1, 7).supported);
+
+        CFREngineConfig transposed_config;
+        transposed_config.transpositions = TranspositionRule::PUBLIC_STATE;
+        CFREngine transposed(abstraction, transposed_config);
+        const BestResponse transposed_br(transposed, abstraction);
+        REQUIRE_FALSE(transposed_br.is_supported(root));
+        REQUIRE_FALSE(transposed_br.compute(root, 4, 1, 7).supported);
+    }
+}
+
+TEST_CASE("BestResponse averages unseen board cards before maximising", "[BestResponse]") {
+    // Jeu jouet : turn Ah-2c-3d-Ks, P1 est all-in, P0 suit ou se couche, la river reste à venir.
+    // P0 joue la stratégie optimale exacte (suivre si l'équité moyenne sur les rivers le
+    // justifie) : aucune meilleure réponse ne fait mieux, l'exploitabilité est nulle. Un
+    // joueur BR qui verrait la river suivrait ou se coucherait à coup sûr et la surestimerait.
+    ActionAbstraction abstraction; // fold / call / all-in
+    GameState root(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2);
+    root.clear_private_cards();
+    root.set_explicit_chance_nodes(true);
+    apply(root, abstraction, ActionType::CALL); // Limp : directement au flop
+    for (const char* card : {"Ah", "2c", "3d"}) root.deal_board_card(card_from_string(card));
+    apply(root, abstraction, ActionType::CALL);
+    apply(root, abstraction, ActionType::CALL);
+    root.deal_board_card(card_from_string("Ks"));
+    if (root.get_current_player() == 0) apply(root, abstraction, ActionType::CALL);
+    apply(root, abstraction, ActionType::RAISE);
+    REQUIRE(root.get_current_player() == 0);
+    const std::vector<Action> actions = root.get_legal_abstract_actions(abstraction);
+    REQUIRE(actions.size() == 2);
+
+    Bitboard board = EMPTY_BOARD;
+    for (int i = 0; i < 4; ++i) set_card(board, root.get_board()[i]);
+    const double stake = root.get_player_contribution(1);
+    const double fold_loss = root.get_player_contribution(0);
+
+    // Gain moyen du call par (main adverse, river) : rivers énumérées, 44 x C(45, 2) paires
+    const auto& combos = all_hole_combos();
+    RangeVector call_values(NUM_HOLE_COMBOS, 0.0);
+    for (Bitboard rivers = FULL_DECK & ~board; rivers;) {
+        const Card river = pop_lsb(rivers);
+        std::array<Card, 5> full_board = root.get_board();
+        full_board[4] = river;
+        const BoardRanking ranking = rank_hole_combos(full_board);
+        RangeVector values;
+        showdown_values(make_uniform_range(ranking.board_mask), ranking.hand_ranks, ranking.sorted_combos, stake, values);
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (!(combos[h].mask() & ranking.board_mask)) call_values[h] += values[h] / (44.0 * 990.0);
+        }
+    }
+
+    const std::string checkpoint = (std::filesystem::temp_directory_path() / "gto_best_response_toy.dat").string();
+    {
+        std::ofstream out(checkpoint);
+        int calls = 0;
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (combos[h].mask() & board) continue;
+            const bool call = call_values[h] > -fold_loss;
+            calls += call;
+            out << InformationSet::generate_key(0, {combos[h].c1, combos[h].c2}, root.get_board(), 4,
+                                                root.get_current_street(), {})
+                << ";1;0,0;";
+            for (size_t a = 0; a < actions.size(); ++a) {
+                const bool chosen = (actions[a].type == ActionType::CALL) == call;
+                out << (chosen ? 1 : 0) << (a + 1 < actions.size() ? "," : "\n");
+            }
+        }
+        REQUIRE(calls > 0);
+        REQUIRE(calls < 1081); // C(48, 2) mains : les deux actions sont jouées
+    }
+    CFREngine engine(abstraction);
+    REQUIRE(engine.load_infoset_map(checkpoint));
+    std::remove(checkpoint.c_str());
+
+    BestResponse best_response(engine, abstraction);
+    const ExploitabilityResult result = best_response.compute(root, /*num_chance_samples=*/64, /*num_threads=*/1, /*seed=*/3);
+    REQUIRE(result.exploitability_chips == Catch::Approx(0.0).margin(1e-9));
+}
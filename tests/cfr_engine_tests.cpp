@@ -0,0 +1,441 @@
+#include "gto/cfr_engine.h"
+#include "gto/best_response.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+// Petit arbre (fold / call / all-in) pour garder les tests rapides
+GameState make_small_state() { return GameState(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2); }
+
+std::string temp_path(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+void require_same_maps(const InformationSetMap& a, const InformationSetMap& b) {
+    REQUIRE(a.size() == b.size());
+    for (const auto& [key, node] : a) {
+        auto it = b.find(key);
+        REQUIRE(it != b.end());
+        REQUIRE(it->second.visit_count == node.visit_count);
+        REQUIRE(it->second.num_actions() == node.num_actions());
+        for (size_t i = 0; i < node.num_actions(); ++i) {
+            REQUIRE(it->second.get_regret(i) == Catch::Approx(node.get_regret(i)).margin(1e-6));
+            REQUIRE(it->second.get_strategy_sum(i) == Catch::Approx(node.get_strategy_sum(i)).margin(1e-6));
+        }
+    }
+}
+
+// Égalité exacte (==) : les checkpoints doivent relire les doubles bit à bit.
+void require_identical_maps(const InformationSetMap& a, const InformationSetMap& b) {
+    REQUIRE(a.size() == b.size());
+    for (const auto& [key, node] : a) {
+        auto it = b.find(key);
+        REQUIRE(it != b.end());
+        REQUIRE(it->second.visit_count == node.visit_count);
+        REQUIRE(it->second.num_actions() == node.num_actions());
+        for (size_t i = 0; i < node.num_actions(); ++i) {
+            REQUIRE(it->second.get_regret(i) == node.get_regret(i));
+            REQUIRE(it->second.get_strategy_sum(i) == node.get_strategy_sum(i));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("CFREngine delta checkpoints", "[CFREngine][checkpoint]") {
+    ActionAbstraction abstraction; // all-in seulement
+    CFREngine engine(abstraction);
+
+    const std::string base_file  = temp_path("gto_cfr_test_base.dat");
+    const std::string delta_file = temp_path("gto_cfr_test_delta.dat");
+    const std::string out_file   = temp_path("gto_cfr_test_compacted.dat");
+    std::filesystem::remove(delta_file); // Le delta est ouvert en mode append
+
+    engine.run_iterations(2, make_small_state());
+    REQUIRE(engine.count_dirty_infosets() == engine.get_infoset_map().size());
+
+    REQUIRE(engine.save_infoset_map(base_file));
+    engine.clear_dirty_flags();
+    REQUIRE(engine.count_dirty_infosets() == 0);
+
+    SECTION("Base plus compacted delta reloads the live map bit for bit") {
+        engine.run_iterations(2, make_small_state());
+        const size_t dirty_count = engine.count_dirty_infosets();
+        REQUIRE(dirty_count > 0);
+
+        REQUIRE(engine.save_infoset_delta(delta_file));
+        REQUIRE(engine.count_dirty_infosets() == 0);
+
+        REQUIRE(CFREngine::compact_checkpoints(base_file, {delta_file}, out_file));
+
+        CFREngine reloaded(abstraction);
+        REQUIRE(reloaded.load_infoset_map(out_file));
+        require_identical_maps(engine.get_infoset_map(), reloaded.get_infoset_map());
+        REQUIRE(reloaded.count_dirty_infosets() == 0);
+    }
+
+    SECTION("Deltas replayed on top of a loaded base give the live map bit for bit") {
+        engine.run_iterations(1, make_small_state());
+        std::vector<std::string> first_delta_keys;
+        for (const auto& [key, node] : engine.get_infoset_map()) {
+            if (node.dirty) first_delta_keys.push_back(key);
+        }
+        REQUIRE(engine.save_infoset_delta(delta_file));
+        engine.run_iterations(1, make_small_state());
+        // Infoset sauvegardé dans le premier delta, remis à propre et non retouché depuis :
+        // seule sa ligne du premier delta le restaure.
+        const auto reset_key = std::find_if(first_delta_keys.begin(), first_delta_keys.end(),
+            [&](const std::string& key) { return !engine.get_infoset_map().at(key).dirty; });
+        REQUIRE(reset_key != first_delta_keys.end());
+        REQUIRE(engine.save_infoset_delta(delta_file)); // Second delta ajouté au même fichier
+
+        CFREngine replayed(abstraction);
+        REQUIRE(replayed.load_infoset_map(base_file));
+        REQUIRE(replayed.apply_infoset_delta(delta_file));
+        require_identical_maps(engine.get_infoset_map(), replayed.get_infoset_map());
+        REQUIRE(replayed.get_infoset_map().count(*reset_key) == 1);
+    }
+
+    std::filesystem::remove(base_file);
+    std::filesystem::remove(delta_file);
+    std::filesystem::remove(out_file);
+}
+
+TEST_CASE("CFREngine quantized storage", "[CFREngine][storage]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.storage_precision = {RegretStorage::INT32_SCALED, StrategyStorage::FLOAT16};
+    CFREngine engine(abstraction, config);
+
+    engine.run_iterations(2, make_small_state());
+    REQUIRE_FALSE(engine.get_infoset_map().empty());
+    for (const auto& [key, node] : engine.get_infoset_map()) {
+        REQUIRE(node.precision().regrets == RegretStorage::INT32_SCALED);
+        REQUIRE(node.storage_bytes() == node.num_actions() * 6);
+
+        double total = 0.0;
+        for (double p : engine.get_average_strategy(key)) total += p;
+        REQUIRE(total == Catch::Approx(1.0));
+    }
+}
+
+TEST_CASE("CFREngine regret-based pruning", "[CFREngine][pruning]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.enable_regret_pruning = true;
+    config.pruning_threshold = 0.0; // Toute action à regret négatif est candidate
+    config.pruning_warmup_iterations = 5;
+    config.chance_sampling = ChanceSampling::FIXED_DEAL; // Mêmes infosets à chaque itération
+
+    SECTION("Negative-regret branches are skipped after warm-up") {
+        config.pruning_full_traversal_interval = 0; // Jamais d'exploration complète
+        CFREngine engine(abstraction, config);
+        engine.run_iterations(5, make_small_state());
+        REQUIRE(engine.get_pruned_branch_count() == 0); // Warm-up
+        engine.run_iterations(25, make_small_state());
+        REQUIRE(engine.get_iteration_count() == 30);
+        REQUIRE(engine.get_pruned_branch_count() > 0);
+    }
+
+    SECTION("Full-exploration iterations disable pruning") {
+        config.pruning_full_traversal_interval = 1; // Chaque itération explore tout
+        CFREngine engine(abstraction, config);
+        engine.run_iterations(30, make_small_state());
+        REQUIRE(engine.get_pruned_branch_count() == 0);
+    }
+
+    SECTION("Pruned subtrees skip opponent strategy sums but the average strategy stays close") {
+        config.pruning_full_traversal_interval = 10;
+        config.terminal_runout_samples = 0; // Runouts exacts : seul l'élagage sépare les deux moteurs
+        CFREngine pruned(abstraction, config);
+        config.enable_regret_pruning = false;
+        CFREngine full(abstraction, config);
+        const GameState state = make_small_state(); // Même donne pour les deux moteurs
+        pruned.run_iterations(200, state);
+        full.run_iterations(200, state);
+        REQUIRE(pruned.get_pruned_branch_count() > 0);
+
+        // Infosets adverses d'un sous-arbre élagué : moins de visites (stratégie cumulée
+        // seulement pendant le warm-up et les itérations d'exploration complète)
+        bool fewer_visits = false;
+        double max_gap = 0.0;
+        for (const auto& [key, node] : full.get_infoset_map()) {
+            const auto it = pruned.get_infoset_map().find(key);
+            REQUIRE(it != pruned.get_infoset_map().end()); // Tous créés pendant le warm-up
+            if (it->second.visit_count < node.visit_count) fewer_visits = true;
+            const auto expected = full.get_average_strategy(key);
+            const auto actual = pruned.get_average_strategy(key);
+            for (size_t a = 0; a < expected.size(); ++a) max_gap = std::max(max_gap, std::abs(actual[a] - expected[a]));
+        }
+        REQUIRE(fewer_visits);
+        // Biais borné : la ligne élaguée n'est quasiment pas jouée par la stratégie courante
+        REQUIRE(max_gap < 0.05);
+    }
+}
+
+TEST_CASE("CFREngine reach-probability pruning", "[CFREngine][pruning]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.chance_sampling = ChanceSampling::FIXED_DEAL;
+    config.terminal_runout_samples = 0; // Les sous-arbres sautés ne consomment pas de tirages de runouts
+    const GameState state = make_small_state();
+
+    CFREngine full(abstraction, config);
+    full.run_iterations(100, state);
+    REQUIRE(full.get_metrics().reach_pruned_subtrees == 0);
+
+    config.enable_reach_pruning = true;
+    CFREngine pruned(abstraction, config);
+    pruned.run_iterations(100, state);
+    REQUIRE(pruned.get_metrics().reach_pruned_subtrees > 0);
+    REQUIRE(pruned.get_metrics().nodes_visited < full.get_metrics().nodes_visited);
+
+    // Heads-up, epsilon nul : regrets et stratégies cumulées identiques
+    for (const auto& [key, node] : pruned.get_infoset_map()) {
+        const InformationSet& reference = full.get_infoset_map().at(key);
+        REQUIRE(reference.num_actions() == node.num_actions());
+        for (size_t a = 0; a < node.num_actions(); ++a) {
+            REQUIRE(node.get_regret(a) == Catch::Approx(reference.get_regret(a)).margin(1e-9));
+            REQUIRE(node.get_strategy_sum(a) == Catch::Approx(reference.get_strategy_sum(a)).margin(1e-9));
+        }
+    }
+}
+
+TEST_CASE("CFREngine performance metrics", "[CFREngine][metrics]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.enable_street_timing = true;
+    CFREngine engine(abstraction, config);
+    engine.run_iterations(3, make_small_state());
+
+    const CFRMetrics metrics = engine.get_metrics();
+    REQUIRE(metrics.iterations == 3);
+    REQUIRE(metrics.nodes_visited > metrics.terminal_evaluations);
+    REQUIRE(metrics.terminal_evaluations > 0);
+    REQUIRE(metrics.infoset_lookups == metrics.nodes_visited - metrics.terminal_evaluations);
+    REQUIRE(metrics.infoset_count == engine.get_infoset_map().size());
+    REQUIRE(metrics.infoset_hits == metrics.infoset_lookups - static_cast<long long>(metrics.infoset_count));
+    REQUIRE(metrics.regret_storage_bytes == metrics.strategy_storage_bytes); // Double / double
+    REQUIRE(metrics.regret_rescales == 0); // Aucun dépassement possible en double
+    REQUIRE(metrics.street_seconds[static_cast<size_t>(Street::PREFLOP)] > 0.0);
+
+    const std::string json = metrics.to_json();
+    REQUIRE(json.front() == '{');
+    REQUIRE(json.back() == '}');
+    REQUIRE(json.find("\"nodes_per_second\":") != std::string::npos);
+    REQUIRE(json.find('\n') == std::string::npos); // Une ligne par relevé
+
+    engine.reset_metrics();
+    REQUIRE(engine.get_metrics().nodes_visited == 0);
+    REQUIRE(engine.get_metrics().infoset_count == engine.get_infoset_map().size());
+}
+
+TEST_CASE("CFREngine seeded chance sampling", "[CFREngine][rng]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.seed = 42;
+
+    CFREngine first(abstraction, config);
+    CFREngine second(abstraction, config);
+    first.run_iterations(5, make_small_state());
+    second.run_iterations(5, make_small_state());
+    require_same_maps(first.get_infoset_map(), second.get_infoset_map());
+
+    // Une nouvelle donne par itération : plusieurs mains privées différentes sont visitées
+    size_t root_infosets = 0;
+    for (const auto& [key, node] : first.get_infoset_map()) {
+        if (key.find("|Preflop|") != std::string::npos && key.ends_with("|")) root_infosets++;
+    }
+    REQUIRE(root_infosets > 1);
+}
+
+TEST_CASE("CFREngine explicit board chance nodes", "[CFREngine][chance]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.chance_sampling = ChanceSampling::FIXED_DEAL;
+    config.board_chance = BoardChance::ENUMERATE;
+    const GameState state = make_small_state(); // Mêmes mains privées pour tous les moteurs
+
+    CFREngine serial(abstraction, config);
+    serial.run_iterations(2, state);
+    REQUIRE(serial.get_metrics().chance_nodes > 0);
+
+    // Issues de turn/river réparties entre threads : mêmes infosets, mêmes valeurs
+    config.chance_threads = 2;
+    CFREngine parallel(abstraction, config);
+    parallel.run_iterations(2, state);
+    require_same_maps(serial.get_infoset_map(), parallel.get_infoset_map());
+
+    // Arrondi stochastique des sommes float16 tiré du générateur de la traversée :
+    // toujours indépendant de la répartition entre threads
+    config.storage_precision = {RegretStorage::DOUBLE, StrategyStorage::FLOAT16};
+    CFREngine parallel_half(abstraction, config);
+    parallel_half.run_iterations(2, state);
+    config.chance_threads = 1;
+    CFREngine serial_half(abstraction, config);
+    serial_half.run_iterations(2, state);
+    require_same_maps(serial_half.get_infoset_map(), parallel_half.get_infoset_map());
+
+    config.storage_precision = {};
+    config.board_chance = BoardChance::SAMPLE;
+    CFREngine sampled(abstraction, config);
+    sampled.run_iterations(2, state);
+    REQUIRE(sampled.get_infoset_map().size() < serial.get_infoset_map().size());
+}
+
+TEST_CASE("CFREngine public chance sampling", "[CFREngine][pcs]") {
+    ActionAbstraction abstraction;
+    CFREngineConfig config;
+    config.traversal_mode = TraversalMode::PUBLIC_CHANCE_SAMPLING;
+    const GameState state = make_small_state();
+
+    CFREngine engine(abstraction, config);
+    engine.run_iterations(20, state);
+    REQUIRE(engine.get_metrics().chance_nodes > 0);
+
+    // Toutes les mains privées sont mises à jour à chaque itération
+    size_t root_infosets = 0;
+    for (const auto& [key, node] : engine.get_infoset_map()) {
+        if (key.starts_with("P0;") && key.ends_with("|Preflop|")) root_infosets++;
+    }
+    REQUIRE(root_infosets == NUM_HOLE_COMBOS);
+
+    // Moins exploitable que la stratégie uniforme (moteur non entraîné)
+    CFREngine untrained(abstraction);
+    BestResponse trained_br(engine, abstraction);
+    BestResponse uniform_br(untrained, abstraction);
+    const double trained = trained_br.compute(state, 8, /*num_threads=*/2, /*seed=*/7).exploitability_chips;
+    const double uniform = uniform_br.compute(state, 8, /*num_threads=*/2, /*seed=*/7).exploitability_chips;
+    REQUIRE(trained < uniform);
+
+    // Limité au heads-up : aucune itération sur un état à 3 joueurs
+    CFREngine three_handed(abstraction, config);
+    three_handed.run_iterations(1, GameState(3, 20, 0, 0, 2));
+    REQUIRE(three_handed.get_infoset_map().empty());
+
+    // Actions légales lues dans le cache et tampons de nœud pris dans l'arène du thread,
+    // comme la traversée vanilla : mêmes regrets, aucune réservation après la première passe
+    config.cache_legal_actions = true;
+    CFREngine cached(abstraction, config);
+    cached.run_iterations(20, state);
+    REQUIRE(cached.get_metrics().legal_action_hit_rate() > 0.5);
+    REQUIRE(cached.get_infoset_map().size() == engine.get_infoset_map().size());
+    for (const auto& [key, node] : engine.get_infoset_map()) {
+        const InformationSet& other = cached.get_infoset_map().at(key);
+        for (size_t a = 0; a < node.num_actions(); ++a) REQUIRE(other.get_regret(a) == node.get_regret(a));
+    }
+    const size_t reserved = thread_scratch_arena().reserved_bytes();
+    cached.run_iterations(5, state);
+    REQUIRE(thread_scratch_arena().reserved_bytes() == reserved);
+}
+
+TEST_CASE("CFREngine utility vectors", "[CFREngine][multiway]") {
+    ActionAbstraction abstraction; // fold / call / all-in
+    CFREngineConfig config;
+    config.chance_sampling = ChanceSampling::FIXED_DEAL;
+
+    SECTION("Each player maximises its own utility") {
+        // Donne fixe : face à l'all-in, le BB suit si son utilité au showdown dépasse la perte de sa blinde
+        const GameState state = make_small_state();
+        config.terminal_runout_samples = 0; // Runouts énumérés : mêmes utilités que la référence ci-dessous
+        CFREngine engine(abstraction, config);
+        engine.run_iterations(200, state);
+
+        GameState facing_shove = state;
+        std::vector<Action> history;
+        for (const Action& action : facing_shove.get_legal_abstract_actions(abstraction)) {
+            if (action.type == ActionType::RAISE) history.push_back(action);
+        }
+        REQUIRE(history.size() == 1);
+        facing_shove.apply_action(history[0]);
+        const std::vector<Action> responses = facing_shove.get_legal_abstract_actions(abstraction);
+        const std::vector<double> strategy = engine.get_average_strategy(InformationSet::generate_key(
+            1, state.get_player_hand(1), facing_shove.get_board(), 0, Street::PREFLOP, history));
+        REQUIRE(strategy.size() == responses.size());
+
+        for (size_t a = 0; a < responses.size(); ++a) {
+            GameState next = facing_shove;
+            next.apply_action(responses[a]);
+            long long evaluations = 0;
+            const double call_utility = terminal_utilities(next, evaluations)[1];
+            const double fold_utility = -state.get_player_contribution(1);
+            if (responses[a].type == ActionType::CALL && call_utility != fold_utility) {
+                REQUIRE(strategy[a] > (call_utility > fold_utility ? 0.9 : 0.0));
+                REQUIRE(strategy[a] < (call_utility > fold_utility ? 1.0 + 1e-9 : 0.1));
+            }
+        }
+    }
+
+    SECTION("Three-handed traversal updates every seat") {
+        CFREngine engine(abstraction, config);
+        engine.run_iterations(20, GameState(3, 20, 0, 0, 2));
+        std::array<bool, 3> seen{};
+        for (const auto& [key, node] : engine.get_infoset_map()) {
+            seen[key[1] - '0'] = true;
+            const std::vector<double> strategy = engine.get_average_strategy(key);
+            REQUIRE(std::accumulate(strategy.begin(), strategy.end(), 0.0) == Catch::Approx(1.0));
+        }
+        REQUIRE((seen[0] && seen[1] && seen[2]));
+    }
+}
+
+TEST_CASE("CFREngine public-state transpositions", "[CFREngine][transposition]") {
+    // Flop : mise de 2 BB ; ailleurs check / call uniquement
+    ActionAbstraction abstraction(true, true, {}, {{Street::FLOP, {2.0}}}, {}, /*allow_all_in=*/false);
+    const GameState state = make_small_state();
+
+    auto play = [&](std::initializer_list<ActionType> types) {
+        GameState s = state;
+        for (ActionType type : types) {
+            for (const Action& action : s.get_legal_abstract_actions(abstraction)) {
+                if (action.type == type) {
+                    s.apply_action(action);
+                    break;
+                }
+            }
+        }
+        return s;
+    };
+
+    SECTION("Sequences reaching the same public state share its hash") {
+        // Limp (flop direct en heads-up), puis mise-call ou check-mise-call au flop
+        const GameState bet_call = play({ActionType::CALL, ActionType::RAISE, ActionType::CALL});
+        const GameState check_bet_call = play({ActionType::CALL, ActionType::CALL, ActionType::RAISE, ActionType::CALL});
+        const GameState check_check = play({ActionType::CALL, ActionType::CALL, ActionType::CALL});
+        REQUIRE(bet_call.get_current_street() == Street::TURN);
+        REQUIRE(bet_call.public_state_hash() == check_bet_call.public_state_hash());
+        REQUIRE(bet_call.public_state_hash() != check_check.public_state_hash());
+        REQUIRE(state.public_state_hash() != play({ActionType::CALL}).public_state_hash());
+
+        GameState redealt = state;
+        Rng rng(3);
+        redealt.redeal(rng);
+        REQUIRE(redealt.public_state_hash() == state.public_state_hash()); // Cartes privées exclues
+    }
+
+    SECTION("Transposed keys shrink the infoset table") {
+        CFREngineConfig config;
+        config.chance_sampling = ChanceSampling::FIXED_DEAL;
+        CFREngine history_engine(abstraction, config);
+        config.transpositions = TranspositionRule::PUBLIC_STATE;
+        CFREngine transposed_engine(abstraction, config);
+        history_engine.run_iterations(5, state);
+        transposed_engine.run_iterations(5, state);
+
+        REQUIRE(transposed_engine.get_infoset_map().size() < history_engine.get_infoset_map().size());
+        for (const auto& [key, node] : transposed_engine.get_infoset_map()) {
+            REQUIRE(key.find('#') != std::string::npos);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#include "gto/chance.h"
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+Action find_action(const GameState& state, const ActionAbstraction& abstraction, ActionType type) {
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == type) return action;
+    }
+    throw std::runtime_error("action introuvable");
+}
+
+double total_probability(const std::vector<ChanceOutcome>& outcomes) {
+    double total = 0.0;
+    for (const auto& outcome : outcomes) total += outcome.probability;
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("Chance outcome enumeration", "[chance]") {
+    // Board As Ks Qs + main 2h 3d : pique seul, trèfle seul, cœur et carreau distincts
+    Bitboard known = 0;
+    for (const char* s : {"As", "Ks", "Qs", "2h", "3d"}) set_card(known, card_from_string(s));
+
+    auto full = enumerate_chance_outcomes(known, false);
+    REQUIRE(full.size() == 47);
+    REQUIRE(total_probability(full) == Catch::Approx(1.0));
+    for (const auto& outcome : full) REQUIRE_FALSE(test_card(known, outcome.card));
+
+    // Aucune couleur symétrique : pas de réduction
+    REQUIRE(enumerate_chance_outcomes(known, true).size() == 47);
+
+    // Board As Ks Qs seul : cœur, carreau et trèfle sont interchangeables
+    Bitboard flop = 0;
+    for (const char* s : {"As", "Ks", "Qs"}) set_card(flop, card_from_string(s));
+    auto iso = enumerate_chance_outcomes(flop, true);
+    REQUIRE(iso.size() == 10 + 13);
+    REQUIRE(total_probability(iso) == Catch::Approx(1.0));
+
+    // Avec un générateur : couleur représentante tirée à chaque appel, chacune des trois
+    // couleurs équivalentes représente la classe (pas de biais vers la plus petite)
+    Rng suit_rng(11);
+    std::array<int, 4> representative_counts{};
+    for (int i = 0; i < 300; ++i) {
+        const auto drawn = enumerate_chance_outcomes(flop, true, &suit_rng);
+        REQUIRE(drawn.size() == 10 + 13);
+        REQUIRE(total_probability(drawn) == Catch::Approx(1.0));
+        for (const auto& outcome : drawn) {
+            REQUIRE_FALSE(test_card(flop, outcome.card));
+            if (outcome.probability > 1.5 / 49) representative_counts[outcome.card / 13]++; // Classe de 3 couleurs
+        }
+    }
+    REQUIRE(representative_counts[card_from_string("As") / 13] == 0);
+    int represented_suits = 0;
+    for (int count : representative_counts) represented_suits += count > 0;
+    REQUIRE(represented_suits == 3);
+
+    Rng rng(7);
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE_FALSE(test_card(known, sample_chance_outcome(known, rng)));
+    }
+}
+
+TEST_CASE("GameState explicit chance nodes", "[chance][GameState]") {
+    ActionAbstraction abstraction; // all-in seulement
+
+    SECTION("Board dealt street by street") {
+        GameState state(2, 20, 0, 0, 2);
+        state.set_explicit_chance_nodes(true);
+        state.apply_action(find_action(state, abstraction, ActionType::CALL)); // Limp : flop
+        REQUIRE(state.is_chance_node());
+        REQUIRE(state.get_pending_board_cards() == 3);
+        REQUIRE_FALSE(state.is_terminal());
+        REQUIRE_THROWS_AS(state.apply_action(find_action(state, abstraction, ActionType::CALL)), std::logic_error);
+
+        Bitboard remaining = state.get_remaining_deck_mask();
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE_THROWS_AS(state.deal_board_card(state.get_player_hand(0)[0]), std::invalid_argument);
+            state.deal_board_card(pop_lsb(remaining));
+        }
+        REQUIRE_FALSE(state.is_chance_node());
+        REQUIRE(state.get_board_cards_dealt() == 3);
+        REQUIRE(state.get_current_street() == Street::FLOP);
+        REQUIRE(state.get_current_player() >= 0);
+        REQUIRE_THROWS_AS(state.deal_board_card(pop_lsb(remaining)), std::logic_error);
+    }
+
+    SECTION("All-in runout ends at showdown") {
+        GameState state(2, 20, 0, 0, 2);
+        state.set_explicit_chance_nodes(true);
+        state.apply_action(find_action(state, abstraction, ActionType::RAISE));
+        state.apply_action(find_action(state, abstraction, ActionType::CALL));
+        REQUIRE(state.get_pending_board_cards() == 5);
+
+        Bitboard remaining = state.get_remaining_deck_mask();
+        while (state.is_chance_node()) {
+            REQUIRE_FALSE(state.is_terminal());
+            state.deal_board_card(pop_lsb(remaining));
+        }
+        REQUIRE(state.get_board_cards_dealt() == 5);
+        REQUIRE(state.get_current_street() == Street::SHOWDOWN);
+        REQUIRE(state.is_terminal());
+    }
+}
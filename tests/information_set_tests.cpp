@@ -3,6 +3,8 @@
 #include "gto/action_abstraction.h" // Pour Action, ActionType
 #include "gto/game_state.h" // Pour Street et street_to_string (indirectement)
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <cmath>
 #include <vector>
 #include <string>
 #include <array>
@@ -151,4 +153,117 @@ TEST_CASE("InformationSet::generate_key Tests", "[InformationSet]") {
 
     // TODO: Tester avec des actions de type FOLD dans l'historique.
     // TODO: Tester la robustesse avec des vecteurs/arrays vides où ce n'est pas attendu (si la fonction ne valide pas en amont).
-} 
\ No newline at end of file
+} 
+
+TEST_CASE("InformationSet storage precision", "[InformationSet][storage]") {
+
+    SECTION("Bytes per action") {
+        StoragePrecision full;
+        StoragePrecision compact{RegretStorage::INT32_SCALED, StrategyStorage::FLOAT32};
+        StoragePrecision smallest{RegretStorage::INT32_SCALED, StrategyStorage::FLOAT16};
+        REQUIRE(full.bytes_per_action() == 16);
+        REQUIRE(compact.bytes_per_action() == 8);
+        REQUIRE(smallest.bytes_per_action() == 6);
+
+        InformationSet node;
+        node.initialize(3, smallest);
+        REQUIRE(node.num_actions() == 3);
+        REQUIRE(node.storage_bytes() == 18);
+    }
+
+    SECTION("Scaled int32 regrets keep the regret-matching strategy") {
+        InformationSet exact;
+        InformationSet quantized;
+        exact.initialize(3);
+        quantized.initialize(3, {RegretStorage::INT32_SCALED, StrategyStorage::DOUBLE, 1000.0});
+
+        const std::vector<double> deltas = {1.25, -0.5, 3.75};
+        for (int it = 0; it < 10; ++it) {
+            for (size_t a = 0; a < deltas.size(); ++a) {
+                exact.add_regret(a, deltas[a]);
+                quantized.add_regret(a, deltas[a]);
+            }
+        }
+        for (size_t a = 0; a < deltas.size(); ++a) {
+            REQUIRE(quantized.get_regret(a) == Catch::Approx(exact.get_regret(a)).margin(1e-3));
+        }
+        const auto s_exact = exact.get_current_strategy();
+        const auto s_quant = quantized.get_current_strategy();
+        for (size_t a = 0; a < deltas.size(); ++a) {
+            REQUIRE(s_quant[a] == Catch::Approx(s_exact[a]).margin(1e-6));
+        }
+    }
+
+    SECTION("Int32 overflow rescales instead of wrapping") {
+        InformationSet node;
+        InformationSet exact;
+        node.initialize(2, {RegretStorage::INT32_SCALED, StrategyStorage::DOUBLE, 1000.0});
+        exact.initialize(2);
+        node.set_regret(0, 2.0e6);   // 2e9 unités, proche de INT32_MAX
+        node.set_regret(1, 1.0e6);
+        exact.set_regret(0, 2.0e6);
+        exact.set_regret(1, 1.0e6);
+        REQUIRE(node.add_regret(0, 5.0e5)); // Dépasserait INT32_MAX : remise à l'échelle signalée
+        exact.add_regret(0, 5.0e5);
+        REQUIRE(node.get_regret(0) == Catch::Approx(1.25e6));
+        REQUIRE(node.get_regret(1) == Catch::Approx(5.0e5));
+        // Incrément divisé avec le reste de l'infoset : même stratégie qu'en double
+        const auto strategy = node.get_current_strategy();
+        const auto expected = exact.get_current_strategy();
+        REQUIRE(strategy[0] == Catch::Approx(expected[0]).margin(1e-9));
+        REQUIRE(strategy[1] == Catch::Approx(expected[1]).margin(1e-9));
+
+        REQUIRE_FALSE(node.add_regret(1, -1.0e9)); // Sature au plancher au lieu de déborder
+        REQUIRE(node.get_regret(1) < 0.0);
+        REQUIRE(node.get_regret(0) == Catch::Approx(1.25e6));
+    }
+
+    SECTION("Precision descriptor is shared, not stored per infoset") {
+        const StoragePrecision quantized{RegretStorage::INT32_SCALED, StrategyStorage::FLOAT16, 250.0};
+        InformationSet a;
+        InformationSet b;
+        InformationSet c;
+        a.initialize(2, quantized);
+        b.initialize(2);
+        c.initialize(2, quantized);
+        REQUIRE(a.precision() == quantized);
+        REQUIRE(b.precision() == StoragePrecision{});
+        REQUIRE(&a.precision() == &c.precision());
+        // Un index d'un octet remplace le StoragePrecision embarqué (16 octets)
+        REQUIRE(sizeof(InformationSet) < sizeof(std::string) + sizeof(std::vector<uint8_t>) + sizeof(StoragePrecision) + 8);
+    }
+
+    SECTION("Float16 strategy sums rescale and keep the average strategy") {
+        InformationSet node;
+        node.initialize(2, {RegretStorage::DOUBLE, StrategyStorage::FLOAT16});
+        Rng rng(42);
+        for (int it = 0; it < 100000; ++it) {
+            node.add_strategy_sum(0, 0.75, rng);
+            node.add_strategy_sum(1, 0.25, rng);
+        }
+        const double s0 = node.get_strategy_sum(0);
+        const double s1 = node.get_strategy_sum(1);
+        REQUIRE(std::isfinite(s0));
+        REQUIRE(s0 < 65504.0);
+        REQUIRE(s0 / (s0 + s1) == Catch::Approx(0.75).margin(0.03));
+    }
+
+    SECTION("Stochastic rounding only depends on the caller's generator") {
+        const StoragePrecision compact{RegretStorage::DOUBLE, StrategyStorage::FLOAT32};
+        InformationSet first;
+        InformationSet second;
+        first.initialize(2, compact);
+        second.initialize(2, compact);
+        first.set_strategy_sum(0, 1.0);
+        second.set_strategy_sum(0, 1.0);
+        Rng first_rng(7);
+        Rng second_rng(7);
+        for (int it = 0; it < 1000; ++it) {
+            first.add_strategy_sum(0, 1e-8, first_rng); // Sous l'ULP float32 de 1.0 : arrondi tiré
+            thread_rng()(); // Le générateur du thread ne doit pas intervenir
+            second.add_strategy_sum(0, 1e-8, second_rng);
+        }
+        REQUIRE(first.get_strategy_sum(0) == second.get_strategy_sum(0));
+        REQUIRE(first.get_strategy_sum(0) > 1.0);
+    }
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/ini_file.hpp"
+#include <stdexcept>
+
+using namespace gto_solver;
+
+TEST_CASE("IniFile parsing", "[ini]") {
+    const IniFile ini = IniFile::parse_string(R"(
+        ; Commentaire
+        name = test
+        [Solver]
+        Iterations = 1000   # commentaire de fin de ligne
+        threads = 4
+        storage = on
+        [flop]
+        pot_fractions = 0.33, 0.75,1.5
+        exact_bets =
+    )");
+
+    REQUIRE(ini.sections() == std::vector<std::string>{"", "solver", "flop"});
+    REQUIRE(ini.get_string("", "name") == "test");
+    REQUIRE(ini.get_int("solver", "iterations") == 1000); // Insensible à la casse
+    REQUIRE(ini.get_int("SOLVER", "threads") == 4);
+    REQUIRE(ini.get_bool("solver", "storage"));
+    REQUIRE(ini.get_int("solver", "absent", 7) == 7);
+    REQUIRE(ini.get_double_list("flop", "pot_fractions") == std::vector<double>{0.33, 0.75, 1.5});
+    REQUIRE(ini.has("flop", "exact_bets"));
+    REQUIRE(ini.get_int_list("flop", "exact_bets").empty());
+    REQUIRE_FALSE(ini.has_section("turn"));
+
+    SECTION("Ill-typed values name their key") {
+        REQUIRE_THROWS_AS(ini.get_int("", "name"), std::invalid_argument);
+        REQUIRE_THROWS_AS(ini.get_double("solver", "storage"), std::invalid_argument);
+        REQUIRE_THROWS_AS(ini.get_bool("solver", "threads"), std::invalid_argument);
+    }
+
+    SECTION("Overrides replace values") {
+        IniFile copy = ini;
+        copy.set("solver", "threads", " 8 ");
+        copy.set("checkpoint", "file", "a.bin");
+        REQUIRE(copy.get_int("solver", "threads") == 8);
+        REQUIRE(copy.get_string("checkpoint", "file") == "a.bin");
+    }
+}
+
+TEST_CASE("IniFile syntax errors report the line", "[ini]") {
+    auto message_of = [](const std::string& text) {
+        try {
+            IniFile::parse_string(text, "cfg.ini");
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    REQUIRE(message_of("[solver]\nthreads\n").rfind("cfg.ini:2:", 0) == 0);
+    REQUIRE(message_of("[solver\n").rfind("cfg.ini:1:", 0) == 0);
+    REQUIRE(message_of("[a]\nx = 1\nx = 2\n").rfind("cfg.ini:3:", 0) == 0);
+    REQUIRE_THROWS_AS(IniFile::load("/nonexistent/config.ini"), std::runtime_error);
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "gto/legal_action_cache.h"
+#include "gto/cfr_engine.h"
+#include "gto/game_state.h"
+#include "core/rng.hpp"
+
+using namespace gto_solver;
+
+namespace {
+
+ActionAbstraction make_abstraction() {
+    return ActionAbstraction(true, true, {{Street::PREFLOP, {1.0}}, {Street::FLOP, {0.5, 1.0}}}, {}, {}, true);
+}
+
+// Parcourt l'arbre de mises (board tiré par GameState) et appelle visit à chaque nœud de décision
+void walk(const GameState& state, const ActionAbstraction& abstraction, const std::function<void(const GameState&)>& visit) {
+    if (state.is_terminal()) return;
+    visit(state);
+    for (const Action& action : abstraction.get_abstract_actions(state)) {
+        GameState next = state;
+        next.apply_action(action);
+        walk(next, abstraction, visit);
+    }
+}
+
+} // namespace
+
+TEST_CASE("LegalActionCache", "[legal_action_cache]") {
+    const ActionAbstraction abstraction = make_abstraction();
+    LegalActionCache cache(abstraction);
+    const GameState root(2, 40, 0, 0, 2);
+
+    SECTION("Cached lists match the generator and are shared across deals") {
+        walk(root, abstraction, [&](const GameState& state) {
+            const std::span<const Action> cached = cache.get(state);
+            REQUIRE(std::vector<Action>(cached.begin(), cached.end()) == abstraction.get_abstract_actions(state));
+        });
+        const size_t entries = cache.size();
+        REQUIRE(entries > 0);
+
+        // Autre donne, mêmes lignes de mises : aucune nouvelle entrée, uniquement des hits
+        GameState other = root;
+        Rng rng(5);
+        other.redeal(rng);
+        walk(other, abstraction, [&](const GameState& state) {
+            bool hit = false;
+            cache.get(state, &hit);
+            REQUIRE(hit);
+        });
+        REQUIRE(cache.size() == entries);
+    }
+
+    SECTION("Concurrent lookups see one list per key") {
+        std::vector<GameState> states;
+        walk(root, abstraction, [&](const GameState& state) { states.push_back(state); });
+        std::vector<std::vector<const Action*>> seen(4);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (const GameState& state : states) seen[t].push_back(cache.get(state).data());
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        for (int t = 1; t < 4; ++t) REQUIRE(seen[t] == seen[0]);
+    }
+
+    SECTION("Engine training is unchanged by the cache") {
+        CFREngineConfig config;
+        CFREngine plain(abstraction, config);
+        config.cache_legal_actions = true;
+        CFREngine cached(abstraction, config);
+        plain.run_iterations(20, root);
+        cached.run_iterations(20, root);
+
+        REQUIRE(cached.get_metrics().legal_action_hit_rate() > 0.5);
+        REQUIRE(plain.get_infoset_map().size() == cached.get_infoset_map().size());
+        for (const auto& [key, node] : plain.get_infoset_map()) {
+            const InformationSet& other = cached.get_infoset_map().at(key);
+            for (size_t a = 0; a < node.num_actions(); ++a) {
+                REQUIRE(other.get_regret(a) == node.get_regret(a));
+                REQUIRE(other.get_strategy_sum(a) == node.get_strategy_sum(a));
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#include "gto/payoffs.h"
+#include "gto/game_state.h"
+#include "gto/action_abstraction.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+void apply(GameState& state, const ActionAbstraction& abstraction, ActionType type) {
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == type) {
+            state.apply_action(action);
+            return;
+        }
+    }
+    throw std::runtime_error("action introuvable");
+}
+
+double utility_sum(const UtilityVector& utilities) {
+    return std::accumulate(utilities.begin(), utilities.end(), 0.0);
+}
+
+} // namespace
+
+TEST_CASE("Side pots from unequal all-ins", "[payoffs][GameState]") {
+    ActionAbstraction abstraction; // fold / call / all-in
+    // P0 SB (1), P1 BB (2), P2 premier à parler
+    GameState state(std::vector<int>{10, 30, 50}, 0, 0, 2);
+    REQUIRE(state.get_current_player() == 2);
+    apply(state, abstraction, ActionType::RAISE); // 50
+    apply(state, abstraction, ActionType::CALL);  // P0 all-in 10
+
+    SECTION("Three-way all-in") {
+        apply(state, abstraction, ActionType::CALL); // P1 all-in 30
+        const std::vector<SidePot> pots = state.get_side_pots();
+        REQUIRE(pots.size() == 3);
+        REQUIRE(pots[0].amount == 30);
+        REQUIRE(pots[0].eligible_players == std::vector<int>{0, 1, 2});
+        REQUIRE(pots[1].amount == 40);
+        REQUIRE(pots[1].eligible_players == std::vector<int>{1, 2});
+        REQUIRE(pots[2].amount == 20); // Excédent non payé rendu à P2
+        REQUIRE(pots[2].eligible_players == std::vector<int>{2});
+
+        UtilityVector u = showdown_utilities(state, {1, 2, 3});
+        REQUIRE(u[0] == Catch::Approx(20.0));
+        REQUIRE(u[1] == Catch::Approx(10.0));
+        REQUIRE(u[2] == Catch::Approx(-30.0));
+
+        u = showdown_utilities(state, {1, 1, 3}); // Pot principal partagé
+        REQUIRE(u[0] == Catch::Approx(5.0));
+        REQUIRE(u[1] == Catch::Approx(25.0));
+
+        u = showdown_utilities(state, {5, 4, 3});
+        REQUIRE(u[2] == Catch::Approx(40.0));
+        REQUIRE(utility_sum(u) == Catch::Approx(0.0));
+    }
+
+    SECTION("Folded chips go to the pots they reach") {
+        apply(state, abstraction, ActionType::FOLD); // P1 (2 jetons)
+        const std::vector<SidePot> pots = state.get_side_pots();
+        REQUIRE(pots.size() == 2);
+        REQUIRE(pots[0].amount == 22);
+        REQUIRE(pots[0].eligible_players == std::vector<int>{0, 2});
+        REQUIRE(pots[1].amount == 40);
+
+        const UtilityVector u = showdown_utilities(state, {1, 0, 2});
+        REQUIRE(u[0] == Catch::Approx(12.0));
+        REQUIRE(u[1] == Catch::Approx(-2.0));
+        REQUIRE(u[2] == Catch::Approx(-10.0));
+    }
+}
+
+TEST_CASE("Terminal utilities", "[payoffs]") {
+    ActionAbstraction abstraction;
+    long long evaluations = 0;
+
+    SECTION("Everyone folds to the big blind") {
+        GameState state(3, 20, 0, 0, 2);
+        apply(state, abstraction, ActionType::FOLD);
+        apply(state, abstraction, ActionType::FOLD);
+        REQUIRE(state.is_terminal());
+        const UtilityVector u = terminal_utilities(state, evaluations);
+        REQUIRE(u[0] == Catch::Approx(-1.0));
+        REQUIRE(u[1] == Catch::Approx(1.0));
+        REQUIRE(u[2] == Catch::Approx(0.0));
+        REQUIRE(evaluations == 0);
+    }
+
+    SECTION("Heads-up showdown rewards the lower rank") {
+        GameState state(2, 20, 0, 0, 2);
+        while (!state.is_terminal()) apply(state, abstraction, ActionType::CALL);
+        REQUIRE(state.get_board_cards_dealt() == 5);
+        std::vector<Card> board(state.get_board().begin(), state.get_board().end());
+        const HandRank r0 = evaluate_hand_7_card(state.get_player_hand(0)[0], state.get_player_hand(0)[1], board);
+        const HandRank r1 = evaluate_hand_7_card(state.get_player_hand(1)[0], state.get_player_hand(1)[1], board);
+
+        const UtilityVector u = terminal_utilities(state, evaluations);
+        REQUIRE(evaluations == 2);
+        REQUIRE(u[0] == Catch::Approx(r0 < r1 ? 2.0 : r0 > r1 ? -2.0 : 0.0));
+        REQUIRE(u[0] + u[1] == Catch::Approx(0.0));
+    }
+
+    SECTION("Incomplete board averages over runouts") {
+        GameState state(2, 20, 0, 0, 2);
+        state.set_explicit_chance_nodes(true);
+        apply(state, abstraction, ActionType::RAISE);
+        apply(state, abstraction, ActionType::CALL);
+        Bitboard remaining = state.get_remaining_deck_mask();
+        for (int i = 0; i < 4; ++i) state.deal_board_card(pop_lsb(remaining));
+        REQUIRE(state.get_pending_board_cards() == 1);
+
+        double expected = 0.0;
+        int rivers = 0;
+        for (Bitboard rivers_left = state.get_remaining_deck_mask(); rivers_left; ++rivers) {
+            GameState river = state;
+            river.deal_board_card(pop_lsb(rivers_left));
+            expected += terminal_utilities(river, evaluations)[0];
+        }
+        REQUIRE(rivers == 44);
+        const UtilityVector u = terminal_utilities(state, evaluations);
+        REQUIRE(u[0] == Catch::Approx(expected / rivers));
+        REQUIRE(utility_sum(u) == Catch::Approx(0.0).margin(1e-9));
+    }
+
+    SECTION("Sampled runouts bound the work and average to the exact value") {
+        GameState state(2, 20, 0, 0, 2);
+        apply(state, abstraction, ActionType::RAISE);
+        apply(state, abstraction, ActionType::CALL); // All-in préflop : flop seul tiré (mode DEALT)
+        REQUIRE(state.is_terminal());
+        REQUIRE(state.get_board_cards_dealt() == 3);
+        const double exact = terminal_utilities(state, evaluations)[0];
+
+        Rng rng(3);
+        evaluations = 0;
+        const UtilityVector sampled = terminal_utilities(state, evaluations, &rng, 8);
+        REQUIRE(evaluations == 2 * 8); // 8 runouts sur 990
+        REQUIRE(utility_sum(sampled) == Catch::Approx(0.0).margin(1e-9));
+        REQUIRE(heads_up_terminal_utility(state, evaluations, nullptr, 8) == Catch::Approx(exact)); // Sans rng : exact
+
+        double mean = 0.0;
+        for (int i = 0; i < 400; ++i) mean += heads_up_terminal_utility(state, evaluations, &rng, 8) / 400;
+        REQUIRE(mean == Catch::Approx(exact).margin(1.5));
+    }
+}
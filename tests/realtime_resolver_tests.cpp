@@ -0,0 +1,174 @@
+#include "gto/realtime_resolver.h"
+#include "gto/cfr_engine.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+GameState make_small_state() { return GameState(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2); }
+
+Action find_action(const GameState& state, const ActionAbstraction& abstraction, ActionType type) {
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == type) return action;
+    }
+    throw std::runtime_error("action introuvable");
+}
+
+} // namespace
+
+TEST_CASE("Realtime resolver from a blueprint checkpoint", "[RealtimeResolver]") {
+    ActionAbstraction abstraction; // fold / call / all-in
+    CFREngine engine(abstraction);
+    engine.run_iterations(300, make_small_state());
+    const std::string checkpoint = (std::filesystem::temp_directory_path() / "gto_resolver_blueprint.txt").string();
+    REQUIRE(engine.save_infoset_map(checkpoint));
+
+    RealtimeResolverConfig config;
+    config.subgame.max_iterations = 20;
+    config.subgame.max_seconds = 0.0;
+    RealtimeResolver resolver(abstraction, config);
+    REQUIRE_FALSE(resolver.load_blueprint(checkpoint + ".absent"));
+    REQUIRE(resolver.load_blueprint(checkpoint));
+    REQUIRE(resolver.get_blueprint().get_infoset_map().size() == engine.get_infoset_map().size());
+
+    const GameState initial = make_small_state();
+    GameState current = initial;
+    std::vector<Action> history;
+
+    SECTION("Ranges follow the blueprint probabilities") {
+        const std::vector<Action> root_actions = current.get_legal_abstract_actions(abstraction);
+        const Action limp = find_action(current, abstraction, ActionType::CALL);
+        const size_t limp_index = std::find(root_actions.begin(), root_actions.end(), limp) - root_actions.begin();
+        const std::string root_key = InformationSet::generate_key(0, {}, current.get_board(), 0, Street::PREFLOP, {});
+        const std::string suffix = root_key.substr(root_key.find('|'));
+        history.push_back(limp);
+        current.apply_action(limp);
+
+        // Limp heads-up : le flop est donné, les combos bloqués sortent des ranges
+        Bitboard flop = EMPTY_BOARD;
+        for (int i = 0; i < current.get_board_cards_dealt(); ++i) set_card(flop, current.get_board()[i]);
+        const auto ranges = resolver.derive_ranges(initial, history, current);
+        int checked = 0;
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            if (all_hole_combos()[h].mask() & flop) {
+                REQUIRE(ranges[0][h] == 0.0);
+                REQUIRE(ranges[1][h] == 0.0);
+                continue;
+            }
+            REQUIRE(ranges[1][h] == 1.0); // Le BB n'a pas encore agi
+            const std::string key = "P0;" + hole_combo_strings()[h] + suffix;
+            if (engine.get_infoset_map().count(key) == 0) continue;
+            REQUIRE(ranges[0][h] == Catch::Approx(engine.get_average_strategy(key)[limp_index]));
+            checked++;
+        }
+        REQUIRE(checked > 0);
+
+        // Historique qui ne mène pas à l'état courant
+        REQUIRE_THROWS_AS(resolver.derive_ranges(initial, history, initial), std::invalid_argument);
+    }
+
+    SECTION("Updates after an off-tree raise follow the translated history") {
+        // Relance à 6 hors arbre (seul l'all-in est abstrait), puis call : l'update du
+        // call lit les infosets du blueprint après l'all-in abstrait
+        const Action all_in = find_action(current, abstraction, ActionType::RAISE);
+        const Action raise{0, ActionType::RAISE, 6};
+        REQUIRE(raise.amount < all_in.amount);
+        history.push_back(raise);
+        current.apply_action(raise);
+        const Action call = find_action(current, abstraction, ActionType::CALL);
+        history.push_back(call);
+        current.apply_action(call);
+
+        GameState abstract_state = initial;
+        abstract_state.apply_action(all_in);
+        const std::vector<Action> abstract_actions = abstract_state.get_legal_abstract_actions(abstraction);
+        const size_t call_index = std::find_if(abstract_actions.begin(), abstract_actions.end(),
+            [](const Action& a) { return a.type == ActionType::CALL; }) - abstract_actions.begin();
+        const std::string key = InformationSet::generate_key(1, {}, abstract_state.get_board(), 0, Street::PREFLOP, {all_in});
+        const std::string suffix = key.substr(key.find('|'));
+
+        std::vector<Action> abstract_history;
+        const auto ranges = resolver.derive_ranges(initial, history, current, &abstract_history);
+        REQUIRE(abstract_history.size() == 2);
+        REQUIRE(abstract_history[0] == all_in);
+        REQUIRE(abstract_history[1] == abstract_actions[call_index]);
+        Bitboard flop = EMPTY_BOARD;
+        for (int i = 0; i < current.get_board_cards_dealt(); ++i) set_card(flop, current.get_board()[i]);
+        int checked = 0;
+        for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+            const std::string hand_key = "P1;" + hole_combo_strings()[h] + suffix;
+            if ((all_hole_combos()[h].mask() & flop) || engine.get_infoset_map().count(hand_key) == 0) continue;
+            REQUIRE(ranges[1][h] == Catch::Approx(engine.get_average_strategy(hand_key)[call_index]));
+            checked++;
+        }
+        REQUIRE(checked > 0);
+    }
+
+    SECTION("River re-solve warm-started from the blueprint") {
+        while (current.get_current_street() != Street::RIVER) {
+            const Action call = find_action(current, abstraction, ActionType::CALL);
+            history.push_back(call);
+            current.apply_action(call);
+        }
+        REQUIRE_THROWS_AS(resolver.get_strategy(current.get_player_hand(0)[0], current.get_player_hand(0)[1]), std::logic_error);
+
+        const ResolveResult result = resolver.resolve(initial, history, current);
+        REQUIRE(result.solve.iterations == 20);
+        REQUIRE(result.solve.leaf_nodes == 0);
+        REQUIRE(result.actions == current.get_legal_abstract_actions(abstraction));
+        REQUIRE(std::accumulate(result.ranges[0].begin(), result.ranges[0].end(), 0.0) > 0.0);
+
+        const std::vector<Card>& hand = current.get_player_hand(current.get_current_player());
+        const std::vector<double> strategy = resolver.get_strategy(hand[0], hand[1]);
+        REQUIRE(strategy.size() == result.actions.size());
+        REQUIRE(std::accumulate(strategy.begin(), strategy.end(), 0.0) == Catch::Approx(1.0));
+    }
+
+    std::filesystem::remove(checkpoint);
+}
+
+TEST_CASE("Realtime re-solve after an off-tree raise", "[RealtimeResolver]") {
+    // Relance préflop à 3 BB dans l'abstraction : une relance réelle à 5 s'y traduit
+    ActionAbstraction abstraction(true, true, {}, {{Street::PREFLOP, {3.0}}});
+    CFREngineConfig engine_config;
+    engine_config.chance_sampling = ChanceSampling::FIXED_DEAL; // Blueprint sur la donne du spot
+    CFREngine engine(abstraction, engine_config);
+    const GameState initial = make_small_state();
+    engine.run_iterations(50, initial);
+    const std::string checkpoint = (std::filesystem::temp_directory_path() / "gto_resolver_off_tree.txt").string();
+    REQUIRE(engine.save_infoset_map(checkpoint));
+
+    RealtimeResolverConfig config;
+    config.subgame.max_iterations = 5;
+    config.subgame.max_seconds = 0.0;
+    RealtimeResolver resolver(abstraction, config);
+    REQUIRE(resolver.load_blueprint(checkpoint));
+    std::filesystem::remove(checkpoint);
+
+    GameState current = initial;
+    std::vector<Action> history;
+    const Action raise{0, ActionType::RAISE, 5};
+    const std::vector<Action> root_actions = current.get_legal_abstract_actions(abstraction);
+    REQUIRE(std::find(root_actions.begin(), root_actions.end(), raise) == root_actions.end());
+    history.push_back(raise);
+    current.apply_action(raise);
+    const Action call = find_action(current, abstraction, ActionType::CALL);
+    history.push_back(call);
+    current.apply_action(call);
+    REQUIRE(current.get_current_street() == Street::FLOP);
+
+    // Clés du sous-jeu construites sur l'historique traduit : le blueprint est retrouvé
+    const ResolveResult result = resolver.resolve(initial, history, current);
+    REQUIRE(result.warm_started_infosets > 0);
+    REQUIRE(result.solve.iterations == 5);
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "core/rng.hpp"
+#include "core/deck.hpp"
+
+using namespace gto_solver;
+
+TEST_CASE("Xoshiro256 generator", "[rng]") {
+    SECTION("Same seed, same sequence") {
+        Rng a(123), b(123), c(124);
+        bool differs = false;
+        for (int i = 0; i < 100; ++i) {
+            const uint64_t x = a();
+            REQUIRE(x == b());
+            differs |= (x != c());
+        }
+        REQUIRE(differs);
+    }
+
+    SECTION("Bounded draws stay in range and cover it") {
+        Rng rng(7);
+        std::array<int, 52> counts{};
+        for (int i = 0; i < 52000; ++i) {
+            const uint32_t v = rng.uniform(52);
+            REQUIRE(v < 52);
+            counts[v]++;
+        }
+        for (int count : counts) REQUIRE(count > 800); // ~1000 attendus
+        for (int i = 0; i < 1000; ++i) {
+            const double u = rng.uniform_real();
+            REQUIRE(u >= 0.0);
+            REQUIRE(u < 1.0);
+        }
+    }
+
+    SECTION("Forked streams are reproducible and distinct") {
+        const Rng parent(99);
+        Rng f0 = parent.fork(0), f0_again = parent.fork(0), f1 = parent.fork(1);
+        const uint64_t x = f0();
+        REQUIRE(x == f0_again());
+        REQUIRE(x != f1());
+    }
+}
+
+TEST_CASE("Deck shuffling with explicit seeds", "[rng][deck]") {
+    Deck a(5), b(5);
+    std::vector<Card> dealt_a, dealt_b;
+    for (int i = 0; i < 52; ++i) {
+        dealt_a.push_back(a.deal_card());
+        dealt_b.push_back(b.deal_card());
+    }
+    REQUIRE(dealt_a == dealt_b);
+    std::sort(dealt_a.begin(), dealt_a.end());
+    for (int i = 0; i < 52; ++i) REQUIRE(dealt_a[i] == i); // Permutation complète
+
+    Rng rng(11);
+    a.shuffle(rng);
+    Rng same(11);
+    b.shuffle(same);
+    for (int i = 0; i < 9; ++i) REQUIRE(a.deal_card() == b.deal_card());
+}
+
+TEST_CASE("Bitboard card sampling", "[rng][deck]") {
+    Rng rng(3);
+
+    SECTION("select_nth_card walks set bits in order") {
+        const Bitboard mask = (1ULL << 4) | (1ULL << 17) | (1ULL << 51);
+        REQUIRE(select_nth_card(mask, 0) == 4);
+        REQUIRE(select_nth_card(mask, 1) == 17);
+        REQUIRE(select_nth_card(mask, 2) == 51);
+    }
+
+    SECTION("deal_cards never returns excluded or duplicate cards") {
+        const Bitboard excluded = 0xFFFFFFFFFULL; // 36 cartes exclues : chemin "masque creux"
+        for (int trial = 0; trial < 200; ++trial) {
+            Card out[5];
+            const Bitboard dealt = deal_cards(excluded, 5, rng, out);
+            REQUIRE(count_set_bits(dealt) == 5);
+            REQUIRE((dealt & excluded) == 0);
+            for (Card c : out) REQUIRE(test_card(dealt, c));
+        }
+        REQUIRE_THROWS(deal_cards(FULL_DECK & ~1ULL, 2, rng));
+    }
+
+    SECTION("Draws are uniform over the remaining cards") {
+        std::array<int, 52> counts{};
+        const Bitboard available = FULL_DECK & ~0xFULL; // 48 cartes : chemin par rejet
+        for (int i = 0; i < 48000; ++i) counts[draw_card(available, rng)]++;
+        for (int c = 0; c < 4; ++c) REQUIRE(counts[c] == 0);
+        for (int c = 4; c < 52; ++c) REQUIRE(counts[c] > 800); // ~1000 attendus
+    }
+
+    SECTION("Deck tracks the remaining-card mask") {
+        Deck deck(1);
+        deck.remove_cards(0xFFULL);
+        REQUIRE(deck.remaining_count() == 44);
+        const Card c = deck.deal_card();
+        REQUIRE(c >= 8);
+        REQUIRE_FALSE(test_card(deck.remaining_mask(), c));
+        deck.shuffle();
+        REQUIRE(deck.remaining_mask() == FULL_DECK);
+    }
+}
@@ -0,0 +1,53 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include "core/scratch_arena.hpp"
+#include "gto/cfr_engine.h"
+
+using namespace gto_solver;
+
+TEST_CASE("ScratchArena", "[arena]") {
+    SECTION("Frames are released in LIFO order and reuse their space") {
+        ScratchArena arena(256);
+        double* first = nullptr;
+        {
+            ScratchArena::Frame outer(arena);
+            auto a = outer.allocate<double>(4);
+            first = a.data();
+            REQUIRE(a.size() == 4);
+            REQUIRE(reinterpret_cast<uintptr_t>(a.data()) % alignof(double) == 0);
+            {
+                ScratchArena::Frame inner(arena);
+                auto b = inner.allocate<char>(3);
+                auto c = inner.allocate<double>(2);
+                REQUIRE(reinterpret_cast<uintptr_t>(c.data()) % alignof(double) == 0);
+                REQUIRE(static_cast<void*>(b.data()) != static_cast<void*>(c.data()));
+            }
+            auto d = outer.allocate<double>(1);
+            REQUIRE(d.data() == first + 4); // Espace de inner rendu
+        }
+        ScratchArena::Frame again(arena);
+        REQUIRE(again.allocate<double>(4).data() == first);
+    }
+
+    SECTION("Large requests chain blocks and earlier spans stay valid") {
+        ScratchArena arena(64);
+        ScratchArena::Frame frame(arena);
+        auto a = frame.allocate<int>(8);
+        for (int i = 0; i < 8; ++i) a[i] = i;
+        auto b = frame.allocate<int>(100); // Plus grand qu'un bloc
+        for (int i = 0; i < 100; ++i) b[i] = -i;
+        for (int i = 0; i < 8; ++i) REQUIRE(a[i] == i);
+        REQUIRE(arena.block_count() == 2);
+    }
+
+    SECTION("No new reservation once the traversal depth is reached") {
+        ActionAbstraction abstraction;
+        CFREngine engine(abstraction);
+        const GameState state(2, 20, 0, 0, 2);
+        engine.run_iterations(20, state);
+        const size_t reserved = thread_scratch_arena().reserved_bytes();
+        REQUIRE(reserved > 0);
+        engine.run_iterations(50, state);
+        REQUIRE(thread_scratch_arena().reserved_bytes() == reserved);
+    }
+}
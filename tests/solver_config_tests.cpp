@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include "gto/solver_config.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace gto_solver;
+
+TEST_CASE("SolverConfig defaults and INI overrides", "[config]") {
+    SECTION("An empty file keeps the built-in run") {
+        const SolverConfig config = SolverConfig::from_ini(IniFile());
+        REQUIRE(config.game.num_players == 2);
+        REQUIRE(config.training.budget.max_iterations == 4);
+        REQUIRE(config.infoset_file == "infoset_map.dat");
+        REQUIRE(config.abstraction.streets.size() == 4);
+        REQUIRE(config.abstraction.streets.at(Street::FLOP).raise_levels.front().exact_bets.size() == 8);
+    }
+
+    SECTION("Sections map onto every component") {
+        const SolverConfig config = SolverConfig::from_ini(IniFile::parse_string(R"(
+            [game]
+            num_players = 3
+            stacks = 100, 150, 200
+            [engine]
+            board_chance = enumerate
+            chance_threads = 4
+            transpositions = public_state
+            [storage]
+            strategy = float16
+            [training]
+            iterations = 50
+            max_seconds = 12.5
+            [checkpoint]
+            file = run.ckpt
+            [flop]
+            pot_fractions = 0.5
+            max_raises = 2
+        )"));
+        const GameState state = config.game.make_initial_state();
+        REQUIRE(state.get_num_players() == 3);
+        REQUIRE(state.get_player_stack(0) + state.get_player_stack(1) + state.get_player_stack(2) +
+                state.get_pot_size() == 450);
+        REQUIRE(config.engine.board_chance == BoardChance::ENUMERATE);
+        REQUIRE(config.engine.chance_threads == 4);
+        REQUIRE(config.engine.transpositions == TranspositionRule::PUBLIC_STATE);
+        REQUIRE(config.engine.storage_precision.strategy == StrategyStorage::FLOAT16);
+        REQUIRE(config.training.budget.max_iterations == 50);
+        REQUIRE(config.training.budget.max_seconds == 12.5);
+        REQUIRE(config.training.checkpoint_file == "run.ckpt");
+        // Abstraction décrite : elle remplace celle par défaut
+        REQUIRE(config.abstraction.streets.size() == 1);
+        REQUIRE(config.abstraction.streets.at(Street::FLOP).max_raises == 2);
+    }
+
+    SECTION("Invalid values are rejected") {
+        REQUIRE_THROWS_AS(SolverConfig::from_ini(IniFile::parse_string("[engine]\nboard_chance = all\n")),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(SolverConfig::from_ini(IniFile::parse_string("[training]\niteration = 5\n")),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(SolverConfig::from_ini(IniFile::parse_string("[game]\nnum_players = 12\n")),
+                          std::invalid_argument);
+        // Niveau de log inconnu : erreur plutôt qu'un repli silencieux sur "off"
+        REQUIRE_THROWS_AS(SolverConfig::from_ini(IniFile::parse_string("[log]\nlevel = inof\n")),
+                          std::invalid_argument);
+        REQUIRE(SolverConfig::from_ini(IniFile::parse_string("[log]\nlevel = debug\n")).log_level ==
+                spdlog::level::debug);
+    }
+}
+
+TEST_CASE("Solver command line", "[config]") {
+    const std::string path = "solver_config_test.ini";
+    {
+        std::ofstream out(path);
+        out << "[training]\niterations = 10\n[engine]\nseed = 3\n";
+    }
+    // Les surcharges s'appliquent après le fichier, même si elles le précèdent
+    const char* argv[] = {"solver", "--iterations", "20", "--config", path.c_str(),
+                          "--flop.raise1.pot_fractions=1.0", "--estimate-only"};
+    const CommandLine command_line = parse_command_line(7, argv);
+    std::remove(path.c_str());
+    REQUIRE_FALSE(command_line.show_help);
+    REQUIRE(command_line.ini.get_int("training", "iterations") == 20);
+    REQUIRE(command_line.ini.get_int("engine", "seed") == 3);
+    REQUIRE(command_line.ini.get_string("flop.raise1", "pot_fractions") == "1.0");
+
+    const SolverConfig config = SolverConfig::from_ini(command_line.ini);
+    REQUIRE(config.estimate_only);
+    REQUIRE(config.engine.seed == 3);
+    REQUIRE(config.abstraction.streets.at(Street::FLOP).raise_levels.size() == 2);
+
+    const char* bad[] = {"solver", "--iterations"};
+    REQUIRE_THROWS_AS(parse_command_line(2, bad), std::invalid_argument);
+    // Une option n'est jamais prise pour la valeur de la précédente
+    const char* missing[] = {"solver", "--config", "--iterations", "5"};
+    REQUIRE_THROWS_AS(parse_command_line(4, missing), std::invalid_argument);
+    const char* negative[] = {"solver", "--engine.pruning_threshold", "-300"};
+    REQUIRE(parse_command_line(3, negative).ini.get_double("engine", "pruning_threshold") == -300.0);
+    const char* help[] = {"solver", "--help"};
+    REQUIRE(parse_command_line(2, help).show_help);
+}
@@ -0,0 +1,152 @@
+#include "gto/subgame_solver.h"
+#include "gto/cfr_engine.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+
+Action find_action(const GameState& state, const ActionAbstraction& abstraction, ActionType type) {
+    for (const Action& action : state.get_legal_abstract_actions(abstraction)) {
+        if (action.type == type) return action;
+    }
+    throw std::runtime_error("action introuvable");
+}
+
+// Limp préflop puis check-check au flop : début du turn, board tiré par le deck
+GameState make_turn_state(const ActionAbstraction& abstraction, std::vector<Action>& history) {
+    GameState state(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2);
+    while (state.get_current_street() != Street::TURN) {
+        const Action call = find_action(state, abstraction, ActionType::CALL);
+        history.push_back(call);
+        state.apply_action(call);
+    }
+    return state;
+}
+
+Bitboard board_mask(const GameState& state) {
+    Bitboard mask = EMPTY_BOARD;
+    for (int i = 0; i < state.get_board_cards_dealt(); ++i) set_card(mask, state.get_board()[i]);
+    return mask;
+}
+
+} // namespace
+
+TEST_CASE("Equity leaf estimator", "[SubgameSolver]") {
+    ActionAbstraction abstraction;
+    std::vector<Action> history;
+    GameState state = make_turn_state(abstraction, history);
+    state.set_explicit_chance_nodes(true);
+    while (!state.is_chance_node()) state.apply_action(find_action(state, abstraction, ActionType::CALL));
+    REQUIRE(state.get_pending_board_cards() == 1); // Frontière turn -> river
+
+    const RangeVector uniform = make_uniform_range(board_mask(state));
+    EquityLeafEstimator estimator;
+    RangeVector v0, v1;
+    estimator.leaf_values({state, history, 1, 0, 0, uniform}, v0);
+    estimator.leaf_values({state, history, 1, 0, 1, uniform}, v1);
+
+    // Ranges identiques : jeu à somme nulle, la somme des valeurs pondérées est nulle
+    double total = 0.0;
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) total += uniform[h] * (v0[h] + v1[h]);
+    REQUIRE(total == Catch::Approx(0.0).margin(1e-6));
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (uniform[h] == 0.0) REQUIRE(v0[h] == 0.0);
+    }
+}
+
+TEST_CASE("Depth-limited subgame solving", "[SubgameSolver]") {
+    ActionAbstraction abstraction; // fold / call / all-in
+    std::vector<Action> history;
+    const GameState turn = make_turn_state(abstraction, history);
+    const RangeVector uniform = make_uniform_range(board_mask(turn));
+
+    EquityLeafEstimator equity;
+    SubgameSolverConfig config;
+    config.max_iterations = 20;
+
+    SubgameSolver shallow(abstraction, equity, config);
+    REQUIRE_THROWS_AS(shallow.solve(), std::logic_error);
+    shallow.build(turn, history, {uniform, uniform});
+    const SubgameSolveResult result = shallow.solve();
+    REQUIRE(result.iterations == 20);
+    REQUIRE(result.leaf_nodes > 0);
+    REQUIRE(shallow.get_root_player() == turn.get_current_player());
+
+    for (int h = 0; h < NUM_HOLE_COMBOS; ++h) {
+        if (uniform[h] == 0.0) continue;
+        const std::vector<double> strategy = shallow.get_root_strategy(h);
+        REQUIRE(strategy.size() == shallow.get_root_actions().size());
+        REQUIRE(std::accumulate(strategy.begin(), strategy.end(), 0.0) == Catch::Approx(1.0));
+    }
+    REQUIRE(shallow.get_average_strategy({find_action(turn, abstraction, ActionType::CALL)}, 0).size() > 0);
+
+    SECTION("Deeper trees enumerate the river") {
+        config.max_street_depth = 1;
+        config.max_iterations = 2;
+        SubgameSolver deep(abstraction, equity, config);
+        deep.build(turn, history, {uniform, uniform});
+        REQUIRE(deep.get_node_count() > shallow.get_node_count());
+        REQUIRE(deep.solve().iterations == 2);
+    }
+
+    SECTION("Time budget") {
+        config.max_iterations = 0;
+        config.max_seconds = 0.05;
+        SubgameSolver timed(abstraction, equity, config);
+        timed.build(turn, history, {uniform, uniform});
+        const SubgameSolveResult timed_result = timed.solve();
+        REQUIRE(timed_result.iterations >= 1);
+        REQUIRE(timed_result.elapsed_seconds < 5.0);
+    }
+
+    SECTION("Multi-valued leaves from a blueprint") {
+        CFREngine blueprint(abstraction);
+        BlueprintLeafEstimator continuations(blueprint, abstraction);
+        config.max_iterations = 2;
+        SubgameSolver robust(abstraction, continuations, config);
+        robust.build(turn, history, {uniform, uniform});
+        // Chaque feuille devient un choix entre 4 continuations
+        REQUIRE(robust.get_node_count() > shallow.get_node_count());
+        REQUIRE(robust.solve().iterations == 2);
+    }
+}
+
+TEST_CASE("Subgame warm start from blueprint infosets", "[SubgameSolver]") {
+    ActionAbstraction abstraction;
+    std::vector<Action> history;
+    const GameState turn = make_turn_state(abstraction, history);
+    const RangeVector uniform = make_uniform_range(board_mask(turn));
+
+    EquityLeafEstimator equity;
+    SubgameSolver solver(abstraction, equity);
+    solver.build(turn, history, {uniform, uniform});
+    const size_t num_actions = solver.get_root_actions().size();
+    REQUIRE(num_actions >= 2);
+
+    // Une seule main connue du "blueprint", qui joue toujours l'action 1
+    int combo = 0;
+    while (uniform[combo] == 0.0) combo++;
+    const int player = solver.get_root_player();
+    const std::string full_key = InformationSet::generate_key(
+        player, {}, turn.get_board(), turn.get_board_cards_dealt(), turn.get_current_street(), history);
+    InformationSet infoset;
+    infoset.key = "P" + std::to_string(player) + ";" + hole_combo_strings()[combo] + full_key.substr(full_key.find('|'));
+    infoset.initialize(num_actions);
+    infoset.set_strategy_sum(1, 50.0);
+    infoset.set_regret(1, 10.0);
+    infoset.visit_count = 5;
+    InformationSetMap infosets;
+    infosets.emplace(infoset.key, infoset);
+    infosets.emplace("P0;AhAs|inconnu", infoset); // Clé hors sous-jeu : ignorée
+
+    REQUIRE(solver.warm_start(infosets, 1000.0) == 1);
+    REQUIRE(solver.get_root_strategy(combo)[1] == Catch::Approx(1.0));
+    REQUIRE(solver.get_root_strategy(combo + 1)[1] == Catch::Approx(1.0 / num_actions));
+}
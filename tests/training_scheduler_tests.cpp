@@ -0,0 +1,90 @@
+#include "gto/training_scheduler.h"
+#include "gto/cfr_engine.h"
+#include "gto/action_abstraction.h"
+#include "gto/game_state.h"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace gto_solver;
+
+namespace {
+GameState make_small_state() { return GameState(2, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2); }
+}
+
+TEST_CASE("TrainingScheduler budgets", "[TrainingScheduler]") {
+    ActionAbstraction abstraction;
+    CFREngine engine(abstraction);
+    TrainingSchedulerConfig config;
+    config.evaluation_chance_samples = 1;
+    config.evaluation_threads = 1;
+
+    SECTION("Stops on the iteration budget and evaluates along the way") {
+        config.budget.max_iterations = 12;
+        config.min_iterations_between_evaluations = 4;
+        config.max_iterations_between_evaluations = 4;
+        TrainingScheduler scheduler(engine, abstraction, config);
+        std::vector<int> batch_ends;
+        scheduler.set_progress_callback([&](const TrainingProgress& p) { batch_ends.push_back(p.iterations); });
+
+        const TrainingReport report = scheduler.run(make_small_state());
+        REQUIRE(report.stop_reason == TrainingStopReason::ITERATION_BUDGET);
+        REQUIRE(report.final_progress.iterations == 12);
+        REQUIRE(engine.get_iteration_count() == 12);
+        REQUIRE(report.final_progress.evaluations == 3);
+        // Lots de 1 puis 2 itérations (sondage), puis coupés aux évaluations
+        REQUIRE(batch_ends == std::vector<int>{1, 3, 4, 8, 12});
+    }
+
+    SECTION("Stops as soon as the exploitability target is reached") {
+        config.budget.max_iterations = 1000;
+        config.budget.target_exploitability_mbb = 1e12; // Atteinte dès la première évaluation
+        TrainingScheduler scheduler(engine, abstraction, config);
+        const TrainingReport report = scheduler.run(make_small_state());
+        REQUIRE(report.stop_reason == TrainingStopReason::EXPLOITABILITY_TARGET);
+        REQUIRE(report.final_progress.evaluations == 1);
+        REQUIRE(report.final_progress.iterations < 1000);
+    }
+
+    SECTION("Stops on the time budget and writes a final checkpoint") {
+        const std::string checkpoint = (std::filesystem::temp_directory_path() / "gto_scheduler_test.dat").string();
+        config.enable_evaluation = false;
+        config.budget.max_seconds = 0.05;
+        config.checkpoint_file = checkpoint;
+        TrainingScheduler scheduler(engine, abstraction, config);
+        const TrainingReport report = scheduler.run(make_small_state());
+        REQUIRE(report.stop_reason == TrainingStopReason::TIME_BUDGET);
+        // Premier lot d'une itération puis lots bornés par le temps restant : pas de dépassement massif
+        REQUIRE(report.final_progress.elapsed_seconds < 1.0);
+        REQUIRE(report.final_progress.checkpoints >= 1);
+        REQUIRE(std::filesystem::exists(checkpoint));
+        std::filesystem::remove(checkpoint);
+        std::filesystem::remove(checkpoint + ".delta");
+    }
+
+    SECTION("Disables evaluation when the best response is unsupported") {
+        const GameState three_handed(3, /*stack=*/20, /*ante=*/0, /*button_pos=*/0, /*bb=*/2);
+        config.budget.target_exploitability_mbb = 1e12; // Serait atteinte par une exploitabilité nulle
+        config.min_iterations_between_evaluations = 1;
+        config.max_iterations_between_evaluations = 1;
+        {
+            TrainingScheduler scheduler(engine, abstraction, config);
+            REQUIRE_THROWS_AS(scheduler.run(three_handed), std::invalid_argument); // Plus aucun critère d'arrêt
+        }
+        config.budget.max_iterations = 6;
+        TrainingScheduler scheduler(engine, abstraction, config);
+        const TrainingReport report = scheduler.run(three_handed);
+        REQUIRE(report.stop_reason == TrainingStopReason::ITERATION_BUDGET);
+        REQUIRE(report.final_progress.iterations == 6);
+        REQUIRE(report.final_progress.evaluations == 0);
+        REQUIRE_FALSE(report.final_progress.has_evaluation);
+    }
+
+    SECTION("Refuses to run without any stop criterion") {
+        config.enable_evaluation = false;
+        TrainingScheduler scheduler(engine, abstraction, config);
+        REQUIRE_THROWS_AS(scheduler.run(make_small_state()), std::invalid_argument);
+    }
+}
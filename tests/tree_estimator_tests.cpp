@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "gto/tree_estimator.h"
+#include "core/bitboard.hpp"
+
+using namespace gto_solver;
+
+namespace {
+
+// Comptage de référence : parcours séquentiel direct de l'arbre de mises ; longueur
+// des clés préflop (une seule main factice) lue sur InformationSet::generate_key.
+void count_decision_nodes(GameState state, const ActionAbstraction& abstraction, std::vector<Action>& history,
+                          std::array<long long, 4>& counts, double& preflop_key_heap_bytes) {
+    while (state.is_chance_node()) state.deal_board_card(select_nth_card(state.get_remaining_deck_mask(), 0));
+    if (state.is_terminal()) return;
+    counts[static_cast<size_t>(state.get_current_street())]++;
+    if (state.get_current_street() == Street::PREFLOP) {
+        const std::string key = InformationSet::generate_key(state.get_current_player(), {0, 1}, state.get_board(),
+                                                             0, Street::PREFLOP, history);
+        if (key.size() > std::string().capacity()) preflop_key_heap_bytes += 1326.0 * (key.size() + 1);
+    }
+    for (const Action& action : abstraction.get_abstract_actions(state)) {
+        GameState next = state;
+        next.apply_action(action);
+        history.push_back(action);
+        count_decision_nodes(next, abstraction, history, counts, preflop_key_heap_bytes);
+        history.pop_back();
+    }
+}
+
+} // namespace
+
+TEST_CASE("Tree size estimator", "[tree_estimator]") {
+    const ActionAbstraction abstraction(true, true, {{Street::FLOP, {0.5, 1.0}}, {Street::TURN, {1.0}}}, {}, {}, true);
+    const GameState root(2, 40, 0, 0, 2);
+
+    GameState reference_root = root;
+    reference_root.clear_private_cards();
+    reference_root.set_explicit_chance_nodes(true);
+    std::array<long long, 4> expected{};
+    std::vector<Action> history;
+    double preflop_key_heap_bytes = 0.0;
+    count_decision_nodes(reference_root, abstraction, history, expected, preflop_key_heap_bytes);
+
+    TreeEstimatorConfig config;
+    config.threads = 1;
+    const TreeEstimate sequential = estimate_tree_size(root, abstraction, config);
+    config.threads = 4;
+    const TreeEstimate parallel = estimate_tree_size(root, abstraction, config);
+
+    SECTION("Node counts match a direct walk, whatever the thread count") {
+        REQUIRE_FALSE(sequential.truncated);
+        for (size_t s = 0; s < 4; ++s) {
+            REQUIRE(sequential.streets[s].decision_nodes == expected[s]);
+            REQUIRE(parallel.streets[s].decision_nodes == expected[s]);
+            REQUIRE(parallel.streets[s].action_slots == sequential.streets[s].action_slots);
+            REQUIRE(parallel.streets[s].infosets == Catch::Approx(sequential.streets[s].infosets));
+        }
+        REQUIRE(parallel.terminal_nodes == sequential.terminal_nodes);
+        // Preflop : une infoset par main privée et par nœud public
+        REQUIRE(sequential.streets[0].infosets == Catch::Approx(1326.0 * expected[0]));
+        REQUIRE(sequential.streets[0].key_heap_bytes == Catch::Approx(preflop_key_heap_bytes));
+        REQUIRE(preflop_key_heap_bytes > 0.0);
+    }
+
+    SECTION("Projected memory follows the storage precision") {
+        StoragePrecision compact;
+        compact.regrets = RegretStorage::INT32_SCALED;
+        compact.strategy = StrategyStorage::FLOAT16;
+        const double full_bytes = sequential.projected_bytes(StoragePrecision{});
+        const double compact_bytes = sequential.projected_bytes(compact);
+        REQUIRE(compact_bytes < full_bytes);
+        REQUIRE(full_bytes - compact_bytes == Catch::Approx(sequential.total().infoset_action_slots * 10.0));
+        REQUIRE(sequential.report().find("int32 / float16") != std::string::npos);
+    }
+
+    SECTION("Transpositions are counted as distinct public states") {
+        config.count_transpositions = true;
+        const TreeEstimate transposed = estimate_tree_size(root, abstraction, config);
+        REQUIRE(transposed.streets[0].distinct_public_states == expected[0]); // Aucune transposition préflop
+        REQUIRE(transposed.streets[2].distinct_public_states > 0);
+        REQUIRE(transposed.streets[2].distinct_public_states < expected[2]); // Mise-call = check-mise-call
+        REQUIRE(sequential.streets[2].distinct_public_states == 0);
+    }
+
+    SECTION("Node budget truncates the walk") {
+        config.max_public_nodes = 10;
+        const TreeEstimate partial = estimate_tree_size(root, abstraction, config);
+        REQUIRE(partial.truncated);
+        REQUIRE(partial.total().decision_nodes + partial.terminal_nodes <= 10);
+    }
+}